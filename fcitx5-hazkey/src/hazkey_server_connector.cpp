@@ -428,6 +428,42 @@ void HazkeyServerConnector::moveCursor(int offset) {
     return;
 }
 
+void HazkeyServerConnector::resizeClause(int offset) {
+    hazkey::RequestEnvelope request;
+    auto props = request.mutable_resize_clause();
+    props->set_offset(offset);
+    auto response = transact(request);
+    if (response == std::nullopt) {
+        FCITX_ERROR() << "Error while transacting resizeClause().";
+        return;
+    }
+    auto responseVal = response.value();
+    if (responseVal.status() != hazkey::SUCCESS) {
+        FCITX_ERROR() << "resizeClause:" << "Server returned an error: "
+                      << responseVal.error_message();
+        return;
+    }
+    return;
+}
+
+std::string HazkeyServerConnector::reconvert(std::string text) {
+    hazkey::RequestEnvelope request;
+    auto props = request.mutable_reconvert();
+    props->set_text(text);
+    auto response = transact(request);
+    if (response == std::nullopt) {
+        FCITX_ERROR() << "Error while transacting reconvert().";
+        return "";
+    }
+    auto responseVal = response.value();
+    if (responseVal.status() != hazkey::SUCCESS) {
+        FCITX_ERROR() << "reconvert: " << "Server returned an error: "
+                      << responseVal.error_message();
+        return "";
+    }
+    return responseVal.text();
+}
+
 void HazkeyServerConnector::setContext(std::string context, int anchor) {
     hazkey::RequestEnvelope request;
     auto props = request.mutable_set_context();
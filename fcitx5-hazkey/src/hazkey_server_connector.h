@@ -49,6 +49,11 @@ class HazkeyServerConnector {
 
     void moveCursor(int offset);
 
+    void resizeClause(int offset);
+
+    // returns the reading of committed text, or "" when it is unknown
+    std::string reconvert(std::string text);
+
     void setContext(std::string context, int anchor);
 
     void setServerConfig(int zenzaiEnabled, int zenzaiInferLimit,
@@ -2,6 +2,7 @@
 
 #include <fcitx-utils/key.h>
 #include <fcitx-utils/log.h>
+#include <fcitx-utils/utf8.h>
 #include <fcitx/candidatelist.h>
 
 #include <algorithm>
@@ -17,6 +18,12 @@
 
 namespace fcitx {
 
+namespace {
+// Zenzai only reads the end of the left context, so long documents are cut
+// here instead of being sent on every keystroke
+constexpr size_t kMaxLeftContextChars = 512;
+}  // namespace
+
 HazkeyState::HazkeyState(HazkeyEngine* engine, InputContext* ic)
     : engine_(engine), ic_(ic), preedit_(HazkeyPreedit(ic)) {
     engine_->server().newComposingText();
@@ -102,6 +109,12 @@ void HazkeyState::noPreeditKeyEvent(KeyEvent& event) {
                 reset();
             }
             break;
+        case FcitxKey_Henkan:
+            if (!startReconversion()) {
+                reset();
+                return event.filter();
+            }
+            break;
         default:
             if (isInputableEvent(event)) {
                 updateSurroundingText();
@@ -151,6 +164,10 @@ void HazkeyState::preeditKeyEvent(
             functionKeyHandler(event);
             break;
         case FcitxKey_Escape:
+            if (!reconvertingText_.empty()) {
+                // put back the text that was selected
+                ic_->commitString(reconvertingText_);
+            }
             reset();
             break;
         case FcitxKey_space:
@@ -227,19 +244,35 @@ void HazkeyState::candidateKeyEvent(
     std::vector<std::string> preedit;
     switch (keysym) {
         case FcitxKey_Right:
-            // if (event.key().states() == KeyState::Alt) {
-            candidateList->nextPage();
-            // }
+            if (key.states() == KeyState::Shift) {
+                // extend the first clause
+                engine_->server().resizeClause(1);
+                showNonPredictCandidateList();
+            } else {
+                candidateList->nextPage();
+            }
             break;
         case FcitxKey_Left:
-            // if (event.key().states() == KeyState::Alt) {
-            candidateList->prevPage();
-            // }
+            if (key.states() == KeyState::Shift) {
+                // shrink the first clause
+                engine_->server().resizeClause(-1);
+                showNonPredictCandidateList();
+            } else {
+                candidateList->prevPage();
+            }
             break;
         case FcitxKey_Return:
             candidateCompleteHandler(candidateList);
             break;
         case FcitxKey_Escape:
+            if (!reconvertingText_.empty()) {
+                // cancel the whole reconversion, not only the candidate list
+                ic_->commitString(reconvertingText_);
+                reset();
+            } else {
+                showPreeditCandidateList();
+            }
+            break;
         case FcitxKey_BackSpace:
             showPreeditCandidateList();
             break;
@@ -304,6 +337,8 @@ void HazkeyState::candidateCompleteHandler(
     // committing so call it with appendText before committing.
     updateSurroundingText(preedit[0]);
     engine_->server().completePrefix(candidateList->globalCursorIndex());
+    // a part of the reconverted text is committed, so it cannot be put back
+    reconvertingText_.clear();
     ic_->commitString(preedit[0]);
     if (preedit.size() > 1) {
         showNonPredictCandidateList();
@@ -313,15 +348,65 @@ void HazkeyState::candidateCompleteHandler(
 }
 
 void HazkeyState::updateSurroundingText(std::string appendText) {
+    std::string leftContext;
     if (ic_->capabilityFlags().test(CapabilityFlag::SurroundingText) &&
-        ic_->surroundingText().isValid()) {
+        ic_->surroundingText().isValid() &&
+        utf8::validate(ic_->surroundingText().text())) {
         auto& surroundingText = ic_->surroundingText();
-        engine_->server().setContext(
-            surroundingText.text() + appendText,
-            surroundingText.anchor() + appendText.length());
-    } else {
-        engine_->server().setContext("", 0);
+        const auto& text = surroundingText.text();
+        // the start of the selection if there is one
+        size_t anchor = std::min<size_t>(
+            std::min(surroundingText.anchor(), surroundingText.cursor()),
+            utf8::length(text));
+        leftContext =
+            text.substr(0, utf8::ncharByteLength(text.begin(), anchor)) +
+            appendText;
+        size_t length = utf8::length(leftContext);
+        if (length > kMaxLeftContextChars) {
+            leftContext.erase(
+                0, utf8::ncharByteLength(leftContext.begin(),
+                                         length - kMaxLeftContextChars));
+        }
     }
+    // most keystrokes do not move the cursor over committed text
+    if (leftContext == lastLeftContext_) {
+        return;
+    }
+    lastLeftContext_ = leftContext;
+    engine_->server().setContext(leftContext, utf8::length(leftContext));
+}
+
+bool HazkeyState::startReconversion() {
+    if (!ic_->capabilityFlags().test(CapabilityFlag::SurroundingText) ||
+        !ic_->surroundingText().isValid() ||
+        !utf8::validate(ic_->surroundingText().text())) {
+        return false;
+    }
+    auto& surroundingText = ic_->surroundingText();
+    const auto& text = surroundingText.text();
+    size_t length = utf8::length(text);
+    size_t cursor = std::min<size_t>(surroundingText.cursor(), length);
+    size_t anchor = std::min<size_t>(surroundingText.anchor(), length);
+    if (cursor == anchor) {
+        return false;
+    }
+    size_t start = std::min(cursor, anchor);
+    size_t end = std::max(cursor, anchor);
+    auto startByte = utf8::ncharByteLength(text.begin(), start);
+    auto selected = text.substr(
+        startByte,
+        utf8::ncharByteLength(text.begin() + startByte, end - start));
+
+    // the server only knows readings of text committed recently
+    if (engine_->server().reconvert(selected).empty()) {
+        return false;
+    }
+    updateSurroundingText();
+    int offset = static_cast<int>(start) - static_cast<int>(cursor);
+    ic_->deleteSurroundingText(offset, end - start);
+    reconvertingText_ = selected;
+    showNonPredictCandidateList();
+    return true;
 }
 
 bool HazkeyState::ctrlShortcutHandler(KeyEvent& event) {
@@ -557,6 +642,8 @@ void HazkeyState::reset() {
     isDirectConversionMode_ = false;
     livePreeditIndex_ = -1;
     isCursorMoving_ = false;
+    lastLeftContext_.clear();
+    reconvertingText_.clear();
     engine_->server().newComposingText();
     ic_->inputPanel().reset();
 }
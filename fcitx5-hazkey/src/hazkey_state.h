@@ -43,6 +43,9 @@ class HazkeyState : public InputContextProperty {
 
     // update surrounding text
     void updateSurroundingText(std::string appendText = "");
+    // replace the selected text with its reading and convert it again.
+    // returns false if nothing is selected or the reading is unknown
+    bool startReconversion();
 
     bool ctrlShortcutHandler(KeyEvent& keyEvent);
     // f6-f10 key handler
@@ -109,6 +112,10 @@ class HazkeyState : public InputContextProperty {
 
     bool isDirectConversionMode_ = false;
     int livePreeditIndex_ = -1;
+    // left context last sent to the server
+    std::string lastLeftContext_;
+    // selected text being reconverted, committed back on cancel
+    std::string reconvertingText_;
     // engine
     HazkeyEngine* engine_;
     // fcitx input context
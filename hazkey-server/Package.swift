@@ -44,6 +44,9 @@ let package = Package(
             name: "hazkey-server-tests",
             dependencies: [
                 "hazkey-server",
+                .product(
+                    name: "KanaKanjiConverterModule",
+                    package: "AzooKeyKanaKanjiConverter"),
                 .product(name: "SwiftProtobuf", package: "swift-protobuf"),
             ],
             swiftSettings: [.interoperabilityMode(.Cxx)],
@@ -169,6 +169,30 @@ struct Hazkey_RequestEnvelope: Sendable {
     set {payload = .saveLearningData(newValue)}
   }
 
+  var getServerStats: Hazkey_Commands_GetServerStats {
+    get {
+      if case .getServerStats(let v)? = payload {return v}
+      return Hazkey_Commands_GetServerStats()
+    }
+    set {payload = .getServerStats(newValue)}
+  }
+
+  var resizeClause: Hazkey_Commands_ResizeClause {
+    get {
+      if case .resizeClause(let v)? = payload {return v}
+      return Hazkey_Commands_ResizeClause()
+    }
+    set {payload = .resizeClause(newValue)}
+  }
+
+  var reconvert: Hazkey_Commands_Reconvert {
+    get {
+      if case .reconvert(let v)? = payload {return v}
+      return Hazkey_Commands_Reconvert()
+    }
+    set {payload = .reconvert(newValue)}
+  }
+
   var getConfig: Hazkey_Config_GetConfig {
     get {
       if case .getConfig(let v)? = payload {return v}
@@ -209,6 +233,14 @@ struct Hazkey_RequestEnvelope: Sendable {
     set {payload = .reloadZenzaiModel(newValue)}
   }
 
+  var benchmarkZenzai: Hazkey_Config_BenchmarkZenzai {
+    get {
+      if case .benchmarkZenzai(let v)? = payload {return v}
+      return Hazkey_Config_BenchmarkZenzai()
+    }
+    set {payload = .benchmarkZenzai(newValue)}
+  }
+
   var unknownFields = SwiftProtobuf.UnknownStorage()
 
   enum OneOf_Payload: Equatable, Sendable {
@@ -225,11 +257,15 @@ struct Hazkey_RequestEnvelope: Sendable {
     case getCandidates(Hazkey_Commands_GetCandidates)
     case getCurrentInputMode(Hazkey_Commands_GetCurrentInputModeInfo)
     case saveLearningData(Hazkey_Commands_SaveLearningData)
+    case getServerStats(Hazkey_Commands_GetServerStats)
+    case resizeClause(Hazkey_Commands_ResizeClause)
+    case reconvert(Hazkey_Commands_Reconvert)
     case getConfig(Hazkey_Config_GetConfig)
     case setConfig(Hazkey_Config_SetConfig)
     case getDefaultProfile(Hazkey_Config_GetDefaultProfile)
     case clearAllHistory_p(Hazkey_Config_ClearAllHistory)
     case reloadZenzaiModel(Hazkey_Config_ReloadZenzaiModel)
+    case benchmarkZenzai(Hazkey_Config_BenchmarkZenzai)
 
   }
 
@@ -279,6 +315,14 @@ struct Hazkey_ResponseEnvelope: Sendable {
     set {payload = .currentInputModeInfo(newValue)}
   }
 
+  var serverStats: Hazkey_Commands_ServerStats {
+    get {
+      if case .serverStats(let v)? = payload {return v}
+      return Hazkey_Commands_ServerStats()
+    }
+    set {payload = .serverStats(newValue)}
+  }
+
   var currentConfig: Hazkey_Config_CurrentConfig {
     get {
       if case .currentConfig(let v)? = payload {return v}
@@ -287,6 +331,14 @@ struct Hazkey_ResponseEnvelope: Sendable {
     set {payload = .currentConfig(newValue)}
   }
 
+  var zenzaiBenchmarkResult: Hazkey_Config_ZenzaiBenchmarkResult {
+    get {
+      if case .zenzaiBenchmarkResult(let v)? = payload {return v}
+      return Hazkey_Config_ZenzaiBenchmarkResult()
+    }
+    set {payload = .zenzaiBenchmarkResult(newValue)}
+  }
+
   var unknownFields = SwiftProtobuf.UnknownStorage()
 
   enum OneOf_Payload: Equatable, Sendable {
@@ -294,7 +346,9 @@ struct Hazkey_ResponseEnvelope: Sendable {
     case candidates(Hazkey_Commands_CandidatesResult)
     case textWithCursor(Hazkey_Commands_TextWithCursor)
     case currentInputModeInfo(Hazkey_Commands_CurrentInputModeInfo)
+    case serverStats(Hazkey_Commands_ServerStats)
     case currentConfig(Hazkey_Config_CurrentConfig)
+    case zenzaiBenchmarkResult(Hazkey_Config_ZenzaiBenchmarkResult)
 
   }
 
@@ -329,11 +383,15 @@ extension Hazkey_RequestEnvelope: SwiftProtobuf.Message, SwiftProtobuf._MessageI
     11: .standard(proto: "get_candidates"),
     12: .standard(proto: "get_current_input_mode"),
     13: .standard(proto: "save_learning_data"),
+    14: .standard(proto: "get_server_stats"),
+    15: .standard(proto: "resize_clause"),
+    16: .same(proto: "reconvert"),
     100: .standard(proto: "get_config"),
     101: .standard(proto: "set_config"),
     102: .standard(proto: "get_default_profile"),
     103: .standard(proto: "clear_all_history"),
     104: .standard(proto: "reload_zenzai_model"),
+    105: .standard(proto: "benchmark_zenzai"),
   ]
 
   mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
@@ -511,6 +569,45 @@ extension Hazkey_RequestEnvelope: SwiftProtobuf.Message, SwiftProtobuf._MessageI
           self.payload = .saveLearningData(v)
         }
       }()
+      case 14: try {
+        var v: Hazkey_Commands_GetServerStats?
+        var hadOneofValue = false
+        if let current = self.payload {
+          hadOneofValue = true
+          if case .getServerStats(let m) = current {v = m}
+        }
+        try decoder.decodeSingularMessageField(value: &v)
+        if let v = v {
+          if hadOneofValue {try decoder.handleConflictingOneOf()}
+          self.payload = .getServerStats(v)
+        }
+      }()
+      case 15: try {
+        var v: Hazkey_Commands_ResizeClause?
+        var hadOneofValue = false
+        if let current = self.payload {
+          hadOneofValue = true
+          if case .resizeClause(let m) = current {v = m}
+        }
+        try decoder.decodeSingularMessageField(value: &v)
+        if let v = v {
+          if hadOneofValue {try decoder.handleConflictingOneOf()}
+          self.payload = .resizeClause(v)
+        }
+      }()
+      case 16: try {
+        var v: Hazkey_Commands_Reconvert?
+        var hadOneofValue = false
+        if let current = self.payload {
+          hadOneofValue = true
+          if case .reconvert(let m) = current {v = m}
+        }
+        try decoder.decodeSingularMessageField(value: &v)
+        if let v = v {
+          if hadOneofValue {try decoder.handleConflictingOneOf()}
+          self.payload = .reconvert(v)
+        }
+      }()
       case 100: try {
         var v: Hazkey_Config_GetConfig?
         var hadOneofValue = false
@@ -576,6 +673,19 @@ extension Hazkey_RequestEnvelope: SwiftProtobuf.Message, SwiftProtobuf._MessageI
           self.payload = .reloadZenzaiModel(v)
         }
       }()
+      case 105: try {
+        var v: Hazkey_Config_BenchmarkZenzai?
+        var hadOneofValue = false
+        if let current = self.payload {
+          hadOneofValue = true
+          if case .benchmarkZenzai(let m) = current {v = m}
+        }
+        try decoder.decodeSingularMessageField(value: &v)
+        if let v = v {
+          if hadOneofValue {try decoder.handleConflictingOneOf()}
+          self.payload = .benchmarkZenzai(v)
+        }
+      }()
       default: break
       }
     }
@@ -639,6 +749,18 @@ extension Hazkey_RequestEnvelope: SwiftProtobuf.Message, SwiftProtobuf._MessageI
       guard case .saveLearningData(let v)? = self.payload else { preconditionFailure() }
       try visitor.visitSingularMessageField(value: v, fieldNumber: 13)
     }()
+    case .getServerStats?: try {
+      guard case .getServerStats(let v)? = self.payload else { preconditionFailure() }
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 14)
+    }()
+    case .resizeClause?: try {
+      guard case .resizeClause(let v)? = self.payload else { preconditionFailure() }
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 15)
+    }()
+    case .reconvert?: try {
+      guard case .reconvert(let v)? = self.payload else { preconditionFailure() }
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 16)
+    }()
     case .getConfig?: try {
       guard case .getConfig(let v)? = self.payload else { preconditionFailure() }
       try visitor.visitSingularMessageField(value: v, fieldNumber: 100)
@@ -659,6 +781,10 @@ extension Hazkey_RequestEnvelope: SwiftProtobuf.Message, SwiftProtobuf._MessageI
       guard case .reloadZenzaiModel(let v)? = self.payload else { preconditionFailure() }
       try visitor.visitSingularMessageField(value: v, fieldNumber: 104)
     }()
+    case .benchmarkZenzai?: try {
+      guard case .benchmarkZenzai(let v)? = self.payload else { preconditionFailure() }
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 105)
+    }()
     case nil: break
     }
     try unknownFields.traverse(visitor: &visitor)
@@ -680,7 +806,9 @@ extension Hazkey_ResponseEnvelope: SwiftProtobuf.Message, SwiftProtobuf._Message
     4: .same(proto: "candidates"),
     5: .standard(proto: "text_with_cursor"),
     6: .standard(proto: "current_input_mode_info"),
+    7: .standard(proto: "server_stats"),
     100: .standard(proto: "current_config"),
+    101: .standard(proto: "zenzai_benchmark_result"),
   ]
 
   mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
@@ -738,6 +866,19 @@ extension Hazkey_ResponseEnvelope: SwiftProtobuf.Message, SwiftProtobuf._Message
           self.payload = .currentInputModeInfo(v)
         }
       }()
+      case 7: try {
+        var v: Hazkey_Commands_ServerStats?
+        var hadOneofValue = false
+        if let current = self.payload {
+          hadOneofValue = true
+          if case .serverStats(let m) = current {v = m}
+        }
+        try decoder.decodeSingularMessageField(value: &v)
+        if let v = v {
+          if hadOneofValue {try decoder.handleConflictingOneOf()}
+          self.payload = .serverStats(v)
+        }
+      }()
       case 100: try {
         var v: Hazkey_Config_CurrentConfig?
         var hadOneofValue = false
@@ -751,6 +892,19 @@ extension Hazkey_ResponseEnvelope: SwiftProtobuf.Message, SwiftProtobuf._Message
           self.payload = .currentConfig(v)
         }
       }()
+      case 101: try {
+        var v: Hazkey_Config_ZenzaiBenchmarkResult?
+        var hadOneofValue = false
+        if let current = self.payload {
+          hadOneofValue = true
+          if case .zenzaiBenchmarkResult(let m) = current {v = m}
+        }
+        try decoder.decodeSingularMessageField(value: &v)
+        if let v = v {
+          if hadOneofValue {try decoder.handleConflictingOneOf()}
+          self.payload = .zenzaiBenchmarkResult(v)
+        }
+      }()
       default: break
       }
     }
@@ -784,10 +938,18 @@ extension Hazkey_ResponseEnvelope: SwiftProtobuf.Message, SwiftProtobuf._Message
       guard case .currentInputModeInfo(let v)? = self.payload else { preconditionFailure() }
       try visitor.visitSingularMessageField(value: v, fieldNumber: 6)
     }()
+    case .serverStats?: try {
+      guard case .serverStats(let v)? = self.payload else { preconditionFailure() }
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 7)
+    }()
     case .currentConfig?: try {
       guard case .currentConfig(let v)? = self.payload else { preconditionFailure() }
       try visitor.visitSingularMessageField(value: v, fieldNumber: 100)
     }()
+    case .zenzaiBenchmarkResult?: try {
+      guard case .zenzaiBenchmarkResult(let v)? = self.payload else { preconditionFailure() }
+      try visitor.visitSingularMessageField(value: v, fieldNumber: 101)
+    }()
     case nil: break
     }
     try unknownFields.traverse(visitor: &visitor)
@@ -288,6 +288,40 @@ struct Hazkey_Commands_SaveLearningData: Sendable {
   init() {}
 }
 
+struct Hazkey_Commands_GetServerStats: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  init() {}
+}
+
+struct Hazkey_Commands_ResizeClause: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  var offset: Int32 = 0
+
+  var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  init() {}
+}
+
+struct Hazkey_Commands_Reconvert: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  var text: String = String()
+
+  var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  init() {}
+}
+
 struct Hazkey_Commands_Text: Sendable {
   // SwiftProtobuf.Message conformance is added in an extension below. See the
   // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
@@ -394,6 +428,244 @@ struct Hazkey_Commands_CurrentInputModeInfo: Sendable {
   init() {}
 }
 
+struct Hazkey_Commands_ServerStats: @unchecked Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  var zenzai: Hazkey_Commands_ServerStats.ZenzaiStats {
+    get {return _storage._zenzai ?? Hazkey_Commands_ServerStats.ZenzaiStats()}
+    set {_uniqueStorage()._zenzai = newValue}
+  }
+  /// Returns true if `zenzai` has been explicitly set.
+  var hasZenzai: Bool {return _storage._zenzai != nil}
+  /// Clears the value of `zenzai`. Subsequent reads from it will return its default value.
+  mutating func clearZenzai() {_uniqueStorage()._zenzai = nil}
+
+  var dictionary: Hazkey_Commands_ServerStats.DictionaryStats {
+    get {return _storage._dictionary ?? Hazkey_Commands_ServerStats.DictionaryStats()}
+    set {_uniqueStorage()._dictionary = newValue}
+  }
+  /// Returns true if `dictionary` has been explicitly set.
+  var hasDictionary: Bool {return _storage._dictionary != nil}
+  /// Clears the value of `dictionary`. Subsequent reads from it will return its default value.
+  mutating func clearDictionary() {_uniqueStorage()._dictionary = nil}
+
+  var memory: Hazkey_Commands_ServerStats.MemoryStats {
+    get {return _storage._memory ?? Hazkey_Commands_ServerStats.MemoryStats()}
+    set {_uniqueStorage()._memory = newValue}
+  }
+  /// Returns true if `memory` has been explicitly set.
+  var hasMemory: Bool {return _storage._memory != nil}
+  /// Clears the value of `memory`. Subsequent reads from it will return its default value.
+  mutating func clearMemory() {_uniqueStorage()._memory = nil}
+
+  var specialProviders: [Hazkey_Commands_ServerStats.SpecialProviderStats] {
+    get {return _storage._specialProviders}
+    set {_uniqueStorage()._specialProviders = newValue}
+  }
+
+  var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  struct ZenzaiStats: Sendable {
+    // SwiftProtobuf.Message conformance is added in an extension below. See the
+    // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+    // methods supported on all messages.
+
+    var conversions: UInt64 = 0
+
+    var estimatedPromptBytes: UInt64 = 0
+
+    var estimatedSharedPrefixBytes: UInt64 = 0
+
+    var estimatedSharedPrefixRatio: Double = 0
+
+    var modelState: Hazkey_Commands_ServerStats.ZenzaiStats.ModelState = .unspecified
+
+    var warmupMs: Double = 0
+
+    var inferenceLimit: UInt32 = 0
+
+    var contextLength: UInt32 = 0
+
+    var latencyP95Ms: Double = 0
+
+    var workerRestarts: UInt32 = 0
+
+    var scoreCacheHits: UInt64 = 0
+
+    var scoreCacheMisses: UInt64 = 0
+
+    var rssBytes: UInt64 = 0
+
+    var idleUnloads: UInt32 = 0
+
+    var unloadRssBeforeBytes: UInt64 = 0
+
+    var unloadRssAfterBytes: UInt64 = 0
+
+    var unknownFields = SwiftProtobuf.UnknownStorage()
+
+    enum ModelState: SwiftProtobuf.Enum, Swift.CaseIterable {
+      typealias RawValue = Int
+      case unspecified // = 0
+      case modelDisabled // = 1
+      case modelLoading // = 2
+      case modelReady // = 3
+      case modelUnloaded // = 4
+      case UNRECOGNIZED(Int)
+
+      init() {
+        self = .unspecified
+      }
+
+      init?(rawValue: Int) {
+        switch rawValue {
+        case 0: self = .unspecified
+        case 1: self = .modelDisabled
+        case 2: self = .modelLoading
+        case 3: self = .modelReady
+        case 4: self = .modelUnloaded
+        default: self = .UNRECOGNIZED(rawValue)
+        }
+      }
+
+      var rawValue: Int {
+        switch self {
+        case .unspecified: return 0
+        case .modelDisabled: return 1
+        case .modelLoading: return 2
+        case .modelReady: return 3
+        case .modelUnloaded: return 4
+        case .UNRECOGNIZED(let i): return i
+        }
+      }
+
+      // The compiler won't synthesize support with the UNRECOGNIZED case.
+      static let allCases: [Hazkey_Commands_ServerStats.ZenzaiStats.ModelState] = [
+        .unspecified,
+        .modelDisabled,
+        .modelLoading,
+        .modelReady,
+        .modelUnloaded,
+      ]
+
+    }
+
+    init() {}
+  }
+
+  struct DictionaryStats: Sendable {
+    // SwiftProtobuf.Message conformance is added in an extension below. See the
+    // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+    // methods supported on all messages.
+
+    var preloadState: Hazkey_Commands_ServerStats.DictionaryStats.PreloadState = .unspecified
+
+    var loadedShards: UInt32 = 0
+
+    var totalShards: UInt32 = 0
+
+    var firstShardMs: Double = 0
+
+    var preloadMs: Double = 0
+
+    var conversionsBeforeReady: UInt64 = 0
+
+    var mappedBytes: UInt64 = 0
+
+    var residentBytes: UInt64 = 0
+
+    var unknownFields = SwiftProtobuf.UnknownStorage()
+
+    enum PreloadState: SwiftProtobuf.Enum, Swift.CaseIterable {
+      typealias RawValue = Int
+      case unspecified // = 0
+      case preloadIdle // = 1
+      case preloadLoading // = 2
+      case preloadReady // = 3
+      case UNRECOGNIZED(Int)
+
+      init() {
+        self = .unspecified
+      }
+
+      init?(rawValue: Int) {
+        switch rawValue {
+        case 0: self = .unspecified
+        case 1: self = .preloadIdle
+        case 2: self = .preloadLoading
+        case 3: self = .preloadReady
+        default: self = .UNRECOGNIZED(rawValue)
+        }
+      }
+
+      var rawValue: Int {
+        switch self {
+        case .unspecified: return 0
+        case .preloadIdle: return 1
+        case .preloadLoading: return 2
+        case .preloadReady: return 3
+        case .UNRECOGNIZED(let i): return i
+        }
+      }
+
+      // The compiler won't synthesize support with the UNRECOGNIZED case.
+      static let allCases: [Hazkey_Commands_ServerStats.DictionaryStats.PreloadState] = [
+        .unspecified,
+        .preloadIdle,
+        .preloadLoading,
+        .preloadReady,
+      ]
+
+    }
+
+    init() {}
+  }
+
+  struct SpecialProviderStats: Sendable {
+    // SwiftProtobuf.Message conformance is added in an extension below. See the
+    // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+    // methods supported on all messages.
+
+    var name: String = String()
+
+    var calls: UInt64 = 0
+
+    var skips: UInt64 = 0
+
+    var totalMs: Double = 0
+
+    var maxMs: Double = 0
+
+    var unknownFields = SwiftProtobuf.UnknownStorage()
+
+    init() {}
+  }
+
+  struct MemoryStats: Sendable {
+    // SwiftProtobuf.Message conformance is added in an extension below. See the
+    // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+    // methods supported on all messages.
+
+    var rssBytes: UInt64 = 0
+
+    var rssAnonBytes: UInt64 = 0
+
+    var rssFileBytes: UInt64 = 0
+
+    var rssShmemBytes: UInt64 = 0
+
+    var unknownFields = SwiftProtobuf.UnknownStorage()
+
+    init() {}
+  }
+
+  init() {}
+
+  fileprivate var _storage = _StorageClass.defaultInstance
+}
+
 // MARK: - Code below here is support for the SwiftProtobuf runtime.
 
 fileprivate let _protobuf_package = "hazkey.commands"
@@ -779,6 +1051,89 @@ extension Hazkey_Commands_SaveLearningData: SwiftProtobuf.Message, SwiftProtobuf
   }
 }
 
+extension Hazkey_Commands_GetServerStats: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = _protobuf_package + ".GetServerStats"
+  static let _protobuf_nameMap = SwiftProtobuf._NameMap()
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    // Load everything into unknown fields
+    while try decoder.nextFieldNumber() != nil {}
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_GetServerStats, rhs: Hazkey_Commands_GetServerStats) -> Bool {
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Commands_ResizeClause: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = _protobuf_package + ".ResizeClause"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "offset"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularInt32Field(value: &self.offset) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.offset != 0 {
+      try visitor.visitSingularInt32Field(value: self.offset, fieldNumber: 1)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_ResizeClause, rhs: Hazkey_Commands_ResizeClause) -> Bool {
+    if lhs.offset != rhs.offset {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Commands_Reconvert: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = _protobuf_package + ".Reconvert"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "text"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularStringField(value: &self.text) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.text.isEmpty {
+      try visitor.visitSingularStringField(value: self.text, fieldNumber: 1)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_Reconvert, rhs: Hazkey_Commands_Reconvert) -> Bool {
+    if lhs.text != rhs.text {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
 extension Hazkey_Commands_Text: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   static let protoMessageName: String = _protobuf_package + ".Text"
   static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
@@ -981,3 +1336,420 @@ extension Hazkey_Commands_CurrentInputModeInfo.InputMode: SwiftProtobuf._ProtoNa
     1: .same(proto: "DIRECT"),
   ]
 }
+
+extension Hazkey_Commands_ServerStats: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = _protobuf_package + ".ServerStats"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "zenzai"),
+    2: .same(proto: "dictionary"),
+    3: .same(proto: "memory"),
+    4: .standard(proto: "special_providers"),
+  ]
+
+  fileprivate class _StorageClass {
+    var _zenzai: Hazkey_Commands_ServerStats.ZenzaiStats? = nil
+    var _dictionary: Hazkey_Commands_ServerStats.DictionaryStats? = nil
+    var _memory: Hazkey_Commands_ServerStats.MemoryStats? = nil
+    var _specialProviders: [Hazkey_Commands_ServerStats.SpecialProviderStats] = []
+
+      // This property is used as the initial default value for new instances of the type.
+      // The type itself is protecting the reference to its storage via CoW semantics.
+      // This will force a copy to be made of this reference when the first mutation occurs;
+      // hence, it is safe to mark this as `nonisolated(unsafe)`.
+      static nonisolated(unsafe) let defaultInstance = _StorageClass()
+
+    private init() {}
+
+    init(copying source: _StorageClass) {
+      _zenzai = source._zenzai
+      _dictionary = source._dictionary
+      _memory = source._memory
+      _specialProviders = source._specialProviders
+    }
+  }
+
+  fileprivate mutating func _uniqueStorage() -> _StorageClass {
+    if !isKnownUniquelyReferenced(&_storage) {
+      _storage = _StorageClass(copying: _storage)
+    }
+    return _storage
+  }
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    _ = _uniqueStorage()
+    try withExtendedLifetime(_storage) { (_storage: _StorageClass) in
+      while let fieldNumber = try decoder.nextFieldNumber() {
+        // The use of inline closures is to circumvent an issue where the compiler
+        // allocates stack space for every case branch when no optimizations are
+        // enabled. https://github.com/apple/swift-protobuf/issues/1034
+        switch fieldNumber {
+        case 1: try { try decoder.decodeSingularMessageField(value: &_storage._zenzai) }()
+        case 2: try { try decoder.decodeSingularMessageField(value: &_storage._dictionary) }()
+        case 3: try { try decoder.decodeSingularMessageField(value: &_storage._memory) }()
+        case 4: try { try decoder.decodeRepeatedMessageField(value: &_storage._specialProviders) }()
+        default: break
+        }
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    try withExtendedLifetime(_storage) { (_storage: _StorageClass) in
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every if/case branch local when no optimizations
+      // are enabled. https://github.com/apple/swift-protobuf/issues/1034 and
+      // https://github.com/apple/swift-protobuf/issues/1182
+      try { if let v = _storage._zenzai {
+        try visitor.visitSingularMessageField(value: v, fieldNumber: 1)
+      } }()
+      try { if let v = _storage._dictionary {
+        try visitor.visitSingularMessageField(value: v, fieldNumber: 2)
+      } }()
+      try { if let v = _storage._memory {
+        try visitor.visitSingularMessageField(value: v, fieldNumber: 3)
+      } }()
+      if !_storage._specialProviders.isEmpty {
+        try visitor.visitRepeatedMessageField(value: _storage._specialProviders, fieldNumber: 4)
+      }
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_ServerStats, rhs: Hazkey_Commands_ServerStats) -> Bool {
+    if lhs._storage !== rhs._storage {
+      let storagesAreEqual: Bool = withExtendedLifetime((lhs._storage, rhs._storage)) { (_args: (_StorageClass, _StorageClass)) in
+        let _storage = _args.0
+        let rhs_storage = _args.1
+        if _storage._zenzai != rhs_storage._zenzai {return false}
+        if _storage._dictionary != rhs_storage._dictionary {return false}
+        if _storage._memory != rhs_storage._memory {return false}
+        if _storage._specialProviders != rhs_storage._specialProviders {return false}
+        return true
+      }
+      if !storagesAreEqual {return false}
+    }
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Commands_ServerStats.ZenzaiStats: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = Hazkey_Commands_ServerStats.protoMessageName + ".ZenzaiStats"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "conversions"),
+    2: .standard(proto: "estimated_prompt_bytes"),
+    3: .standard(proto: "estimated_shared_prefix_bytes"),
+    4: .standard(proto: "estimated_shared_prefix_ratio"),
+    5: .standard(proto: "model_state"),
+    6: .standard(proto: "warmup_ms"),
+    7: .standard(proto: "inference_limit"),
+    8: .standard(proto: "context_length"),
+    9: .standard(proto: "latency_p95_ms"),
+    10: .standard(proto: "worker_restarts"),
+    11: .standard(proto: "score_cache_hits"),
+    12: .standard(proto: "score_cache_misses"),
+    13: .standard(proto: "rss_bytes"),
+    14: .standard(proto: "idle_unloads"),
+    15: .standard(proto: "unload_rss_before_bytes"),
+    16: .standard(proto: "unload_rss_after_bytes"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularUInt64Field(value: &self.conversions) }()
+      case 2: try { try decoder.decodeSingularUInt64Field(value: &self.estimatedPromptBytes) }()
+      case 3: try { try decoder.decodeSingularUInt64Field(value: &self.estimatedSharedPrefixBytes) }()
+      case 4: try { try decoder.decodeSingularDoubleField(value: &self.estimatedSharedPrefixRatio) }()
+      case 5: try { try decoder.decodeSingularEnumField(value: &self.modelState) }()
+      case 6: try { try decoder.decodeSingularDoubleField(value: &self.warmupMs) }()
+      case 7: try { try decoder.decodeSingularUInt32Field(value: &self.inferenceLimit) }()
+      case 8: try { try decoder.decodeSingularUInt32Field(value: &self.contextLength) }()
+      case 9: try { try decoder.decodeSingularDoubleField(value: &self.latencyP95Ms) }()
+      case 10: try { try decoder.decodeSingularUInt32Field(value: &self.workerRestarts) }()
+      case 11: try { try decoder.decodeSingularUInt64Field(value: &self.scoreCacheHits) }()
+      case 12: try { try decoder.decodeSingularUInt64Field(value: &self.scoreCacheMisses) }()
+      case 13: try { try decoder.decodeSingularUInt64Field(value: &self.rssBytes) }()
+      case 14: try { try decoder.decodeSingularUInt32Field(value: &self.idleUnloads) }()
+      case 15: try { try decoder.decodeSingularUInt64Field(value: &self.unloadRssBeforeBytes) }()
+      case 16: try { try decoder.decodeSingularUInt64Field(value: &self.unloadRssAfterBytes) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.conversions != 0 {
+      try visitor.visitSingularUInt64Field(value: self.conversions, fieldNumber: 1)
+    }
+    if self.estimatedPromptBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.estimatedPromptBytes, fieldNumber: 2)
+    }
+    if self.estimatedSharedPrefixBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.estimatedSharedPrefixBytes, fieldNumber: 3)
+    }
+    if self.estimatedSharedPrefixRatio != 0 {
+      try visitor.visitSingularDoubleField(value: self.estimatedSharedPrefixRatio, fieldNumber: 4)
+    }
+    if self.modelState != .unspecified {
+      try visitor.visitSingularEnumField(value: self.modelState, fieldNumber: 5)
+    }
+    if self.warmupMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.warmupMs, fieldNumber: 6)
+    }
+    if self.inferenceLimit != 0 {
+      try visitor.visitSingularUInt32Field(value: self.inferenceLimit, fieldNumber: 7)
+    }
+    if self.contextLength != 0 {
+      try visitor.visitSingularUInt32Field(value: self.contextLength, fieldNumber: 8)
+    }
+    if self.latencyP95Ms != 0 {
+      try visitor.visitSingularDoubleField(value: self.latencyP95Ms, fieldNumber: 9)
+    }
+    if self.workerRestarts != 0 {
+      try visitor.visitSingularUInt32Field(value: self.workerRestarts, fieldNumber: 10)
+    }
+    if self.scoreCacheHits != 0 {
+      try visitor.visitSingularUInt64Field(value: self.scoreCacheHits, fieldNumber: 11)
+    }
+    if self.scoreCacheMisses != 0 {
+      try visitor.visitSingularUInt64Field(value: self.scoreCacheMisses, fieldNumber: 12)
+    }
+    if self.rssBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.rssBytes, fieldNumber: 13)
+    }
+    if self.idleUnloads != 0 {
+      try visitor.visitSingularUInt32Field(value: self.idleUnloads, fieldNumber: 14)
+    }
+    if self.unloadRssBeforeBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.unloadRssBeforeBytes, fieldNumber: 15)
+    }
+    if self.unloadRssAfterBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.unloadRssAfterBytes, fieldNumber: 16)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_ServerStats.ZenzaiStats, rhs: Hazkey_Commands_ServerStats.ZenzaiStats) -> Bool {
+    if lhs.conversions != rhs.conversions {return false}
+    if lhs.estimatedPromptBytes != rhs.estimatedPromptBytes {return false}
+    if lhs.estimatedSharedPrefixBytes != rhs.estimatedSharedPrefixBytes {return false}
+    if lhs.estimatedSharedPrefixRatio != rhs.estimatedSharedPrefixRatio {return false}
+    if lhs.modelState != rhs.modelState {return false}
+    if lhs.warmupMs != rhs.warmupMs {return false}
+    if lhs.inferenceLimit != rhs.inferenceLimit {return false}
+    if lhs.contextLength != rhs.contextLength {return false}
+    if lhs.latencyP95Ms != rhs.latencyP95Ms {return false}
+    if lhs.workerRestarts != rhs.workerRestarts {return false}
+    if lhs.scoreCacheHits != rhs.scoreCacheHits {return false}
+    if lhs.scoreCacheMisses != rhs.scoreCacheMisses {return false}
+    if lhs.rssBytes != rhs.rssBytes {return false}
+    if lhs.idleUnloads != rhs.idleUnloads {return false}
+    if lhs.unloadRssBeforeBytes != rhs.unloadRssBeforeBytes {return false}
+    if lhs.unloadRssAfterBytes != rhs.unloadRssAfterBytes {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Commands_ServerStats.ZenzaiStats.ModelState: SwiftProtobuf._ProtoNameProviding {
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    0: .same(proto: "MODEL_STATE_UNSPECIFIED"),
+    1: .same(proto: "MODEL_DISABLED"),
+    2: .same(proto: "MODEL_LOADING"),
+    3: .same(proto: "MODEL_READY"),
+    4: .same(proto: "MODEL_UNLOADED"),
+  ]
+}
+
+extension Hazkey_Commands_ServerStats.DictionaryStats: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = Hazkey_Commands_ServerStats.protoMessageName + ".DictionaryStats"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .standard(proto: "preload_state"),
+    2: .standard(proto: "loaded_shards"),
+    3: .standard(proto: "total_shards"),
+    4: .standard(proto: "first_shard_ms"),
+    5: .standard(proto: "preload_ms"),
+    6: .standard(proto: "conversions_before_ready"),
+    7: .standard(proto: "mapped_bytes"),
+    8: .standard(proto: "resident_bytes"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularEnumField(value: &self.preloadState) }()
+      case 2: try { try decoder.decodeSingularUInt32Field(value: &self.loadedShards) }()
+      case 3: try { try decoder.decodeSingularUInt32Field(value: &self.totalShards) }()
+      case 4: try { try decoder.decodeSingularDoubleField(value: &self.firstShardMs) }()
+      case 5: try { try decoder.decodeSingularDoubleField(value: &self.preloadMs) }()
+      case 6: try { try decoder.decodeSingularUInt64Field(value: &self.conversionsBeforeReady) }()
+      case 7: try { try decoder.decodeSingularUInt64Field(value: &self.mappedBytes) }()
+      case 8: try { try decoder.decodeSingularUInt64Field(value: &self.residentBytes) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.preloadState != .unspecified {
+      try visitor.visitSingularEnumField(value: self.preloadState, fieldNumber: 1)
+    }
+    if self.loadedShards != 0 {
+      try visitor.visitSingularUInt32Field(value: self.loadedShards, fieldNumber: 2)
+    }
+    if self.totalShards != 0 {
+      try visitor.visitSingularUInt32Field(value: self.totalShards, fieldNumber: 3)
+    }
+    if self.firstShardMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.firstShardMs, fieldNumber: 4)
+    }
+    if self.preloadMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.preloadMs, fieldNumber: 5)
+    }
+    if self.conversionsBeforeReady != 0 {
+      try visitor.visitSingularUInt64Field(value: self.conversionsBeforeReady, fieldNumber: 6)
+    }
+    if self.mappedBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.mappedBytes, fieldNumber: 7)
+    }
+    if self.residentBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.residentBytes, fieldNumber: 8)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_ServerStats.DictionaryStats, rhs: Hazkey_Commands_ServerStats.DictionaryStats) -> Bool {
+    if lhs.preloadState != rhs.preloadState {return false}
+    if lhs.loadedShards != rhs.loadedShards {return false}
+    if lhs.totalShards != rhs.totalShards {return false}
+    if lhs.firstShardMs != rhs.firstShardMs {return false}
+    if lhs.preloadMs != rhs.preloadMs {return false}
+    if lhs.conversionsBeforeReady != rhs.conversionsBeforeReady {return false}
+    if lhs.mappedBytes != rhs.mappedBytes {return false}
+    if lhs.residentBytes != rhs.residentBytes {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Commands_ServerStats.DictionaryStats.PreloadState: SwiftProtobuf._ProtoNameProviding {
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    0: .same(proto: "PRELOAD_STATE_UNSPECIFIED"),
+    1: .same(proto: "PRELOAD_IDLE"),
+    2: .same(proto: "PRELOAD_LOADING"),
+    3: .same(proto: "PRELOAD_READY"),
+  ]
+}
+
+extension Hazkey_Commands_ServerStats.SpecialProviderStats: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = Hazkey_Commands_ServerStats.protoMessageName + ".SpecialProviderStats"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "name"),
+    2: .same(proto: "calls"),
+    3: .same(proto: "skips"),
+    4: .standard(proto: "total_ms"),
+    5: .standard(proto: "max_ms"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularStringField(value: &self.name) }()
+      case 2: try { try decoder.decodeSingularUInt64Field(value: &self.calls) }()
+      case 3: try { try decoder.decodeSingularUInt64Field(value: &self.skips) }()
+      case 4: try { try decoder.decodeSingularDoubleField(value: &self.totalMs) }()
+      case 5: try { try decoder.decodeSingularDoubleField(value: &self.maxMs) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.name.isEmpty {
+      try visitor.visitSingularStringField(value: self.name, fieldNumber: 1)
+    }
+    if self.calls != 0 {
+      try visitor.visitSingularUInt64Field(value: self.calls, fieldNumber: 2)
+    }
+    if self.skips != 0 {
+      try visitor.visitSingularUInt64Field(value: self.skips, fieldNumber: 3)
+    }
+    if self.totalMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.totalMs, fieldNumber: 4)
+    }
+    if self.maxMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.maxMs, fieldNumber: 5)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_ServerStats.SpecialProviderStats, rhs: Hazkey_Commands_ServerStats.SpecialProviderStats) -> Bool {
+    if lhs.name != rhs.name {return false}
+    if lhs.calls != rhs.calls {return false}
+    if lhs.skips != rhs.skips {return false}
+    if lhs.totalMs != rhs.totalMs {return false}
+    if lhs.maxMs != rhs.maxMs {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Commands_ServerStats.MemoryStats: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = Hazkey_Commands_ServerStats.protoMessageName + ".MemoryStats"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .standard(proto: "rss_bytes"),
+    2: .standard(proto: "rss_anon_bytes"),
+    3: .standard(proto: "rss_file_bytes"),
+    4: .standard(proto: "rss_shmem_bytes"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularUInt64Field(value: &self.rssBytes) }()
+      case 2: try { try decoder.decodeSingularUInt64Field(value: &self.rssAnonBytes) }()
+      case 3: try { try decoder.decodeSingularUInt64Field(value: &self.rssFileBytes) }()
+      case 4: try { try decoder.decodeSingularUInt64Field(value: &self.rssShmemBytes) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.rssBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.rssBytes, fieldNumber: 1)
+    }
+    if self.rssAnonBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.rssAnonBytes, fieldNumber: 2)
+    }
+    if self.rssFileBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.rssFileBytes, fieldNumber: 3)
+    }
+    if self.rssShmemBytes != 0 {
+      try visitor.visitSingularUInt64Field(value: self.rssShmemBytes, fieldNumber: 4)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Commands_ServerStats.MemoryStats, rhs: Hazkey_Commands_ServerStats.MemoryStats) -> Bool {
+    if lhs.rssBytes != rhs.rssBytes {return false}
+    if lhs.rssAnonBytes != rhs.rssAnonBytes {return false}
+    if lhs.rssFileBytes != rhs.rssFileBytes {return false}
+    if lhs.rssShmemBytes != rhs.rssShmemBytes {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
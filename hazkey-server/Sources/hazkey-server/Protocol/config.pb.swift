@@ -194,6 +194,15 @@ struct Hazkey_Config_Profile: @unchecked Sendable {
   /// Clears the value of `numSuggestions`. Subsequent reads from it will return its default value.
   mutating func clearNumSuggestions() {_uniqueStorage()._numSuggestions = nil}
 
+  var useEnglishPrediction: Bool {
+    get {return _storage._useEnglishPrediction ?? false}
+    set {_uniqueStorage()._useEnglishPrediction = newValue}
+  }
+  /// Returns true if `useEnglishPrediction` has been explicitly set.
+  var hasUseEnglishPrediction: Bool {return _storage._useEnglishPrediction != nil}
+  /// Clears the value of `useEnglishPrediction`. Subsequent reads from it will return its default value.
+  mutating func clearUseEnglishPrediction() {_uniqueStorage()._useEnglishPrediction = nil}
+
   var useDefaultConversionUiSettings: Bool {
     get {return _storage._useDefaultConversionUiSettings ?? false}
     set {_uniqueStorage()._useDefaultConversionUiSettings = newValue}
@@ -348,6 +357,15 @@ struct Hazkey_Config_Profile: @unchecked Sendable {
   /// Clears the value of `zenzaiContextualMode`. Subsequent reads from it will return its default value.
   mutating func clearZenzaiContextualMode() {_uniqueStorage()._zenzaiContextualMode = nil}
 
+  var zenzaiTimeBudgetMs: Int32 {
+    get {return _storage._zenzaiTimeBudgetMs ?? 0}
+    set {_uniqueStorage()._zenzaiTimeBudgetMs = newValue}
+  }
+  /// Returns true if `zenzaiTimeBudgetMs` has been explicitly set.
+  var hasZenzaiTimeBudgetMs: Bool {return _storage._zenzaiTimeBudgetMs != nil}
+  /// Clears the value of `zenzaiTimeBudgetMs`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiTimeBudgetMs() {_uniqueStorage()._zenzaiTimeBudgetMs = nil}
+
   var useZenzaiCustomWeight: Bool {
     get {return _storage._useZenzaiCustomWeight ?? false}
     set {_uniqueStorage()._useZenzaiCustomWeight = newValue}
@@ -375,6 +393,96 @@ struct Hazkey_Config_Profile: @unchecked Sendable {
   /// Clears the value of `zenzaiBackendDeviceName`. Subsequent reads from it will return its default value.
   mutating func clearZenzaiBackendDeviceName() {_uniqueStorage()._zenzaiBackendDeviceName = nil}
 
+  var zenzaiIsolatedWorker: Bool {
+    get {return _storage._zenzaiIsolatedWorker ?? false}
+    set {_uniqueStorage()._zenzaiIsolatedWorker = newValue}
+  }
+  /// Returns true if `zenzaiIsolatedWorker` has been explicitly set.
+  var hasZenzaiIsolatedWorker: Bool {return _storage._zenzaiIsolatedWorker != nil}
+  /// Clears the value of `zenzaiIsolatedWorker`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiIsolatedWorker() {_uniqueStorage()._zenzaiIsolatedWorker = nil}
+
+  var zenzaiWorkerTimeoutMs: Int32 {
+    get {return _storage._zenzaiWorkerTimeoutMs ?? 0}
+    set {_uniqueStorage()._zenzaiWorkerTimeoutMs = newValue}
+  }
+  /// Returns true if `zenzaiWorkerTimeoutMs` has been explicitly set.
+  var hasZenzaiWorkerTimeoutMs: Bool {return _storage._zenzaiWorkerTimeoutMs != nil}
+  /// Clears the value of `zenzaiWorkerTimeoutMs`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiWorkerTimeoutMs() {_uniqueStorage()._zenzaiWorkerTimeoutMs = nil}
+
+  var zenzaiWorkerMemoryLimitMb: Int32 {
+    get {return _storage._zenzaiWorkerMemoryLimitMb ?? 0}
+    set {_uniqueStorage()._zenzaiWorkerMemoryLimitMb = newValue}
+  }
+  /// Returns true if `zenzaiWorkerMemoryLimitMb` has been explicitly set.
+  var hasZenzaiWorkerMemoryLimitMb: Bool {return _storage._zenzaiWorkerMemoryLimitMb != nil}
+  /// Clears the value of `zenzaiWorkerMemoryLimitMb`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiWorkerMemoryLimitMb() {_uniqueStorage()._zenzaiWorkerMemoryLimitMb = nil}
+
+  var zenzaiUseDraftModel: Bool {
+    get {return _storage._zenzaiUseDraftModel ?? false}
+    set {_uniqueStorage()._zenzaiUseDraftModel = newValue}
+  }
+  /// Returns true if `zenzaiUseDraftModel` has been explicitly set.
+  var hasZenzaiUseDraftModel: Bool {return _storage._zenzaiUseDraftModel != nil}
+  /// Clears the value of `zenzaiUseDraftModel`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiUseDraftModel() {_uniqueStorage()._zenzaiUseDraftModel = nil}
+
+  var zenzaiPersistScoreCache: Bool {
+    get {return _storage._zenzaiPersistScoreCache ?? false}
+    set {_uniqueStorage()._zenzaiPersistScoreCache = newValue}
+  }
+  /// Returns true if `zenzaiPersistScoreCache` has been explicitly set.
+  var hasZenzaiPersistScoreCache: Bool {return _storage._zenzaiPersistScoreCache != nil}
+  /// Clears the value of `zenzaiPersistScoreCache`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiPersistScoreCache() {_uniqueStorage()._zenzaiPersistScoreCache = nil}
+
+  var zenzaiIdleUnloadMinutes: Int32 {
+    get {return _storage._zenzaiIdleUnloadMinutes ?? 0}
+    set {_uniqueStorage()._zenzaiIdleUnloadMinutes = newValue}
+  }
+  /// Returns true if `zenzaiIdleUnloadMinutes` has been explicitly set.
+  var hasZenzaiIdleUnloadMinutes: Bool {return _storage._zenzaiIdleUnloadMinutes != nil}
+  /// Clears the value of `zenzaiIdleUnloadMinutes`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiIdleUnloadMinutes() {_uniqueStorage()._zenzaiIdleUnloadMinutes = nil}
+
+  var zenzaiThreads: Int32 {
+    get {return _storage._zenzaiThreads ?? 0}
+    set {_uniqueStorage()._zenzaiThreads = newValue}
+  }
+  /// Returns true if `zenzaiThreads` has been explicitly set.
+  var hasZenzaiThreads: Bool {return _storage._zenzaiThreads != nil}
+  /// Clears the value of `zenzaiThreads`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiThreads() {_uniqueStorage()._zenzaiThreads = nil}
+
+  var zenzaiCpuPolicy: Hazkey_Config_Profile.ZenzaiCpuPolicy {
+    get {return _storage._zenzaiCpuPolicy ?? .unspecified}
+    set {_uniqueStorage()._zenzaiCpuPolicy = newValue}
+  }
+  /// Returns true if `zenzaiCpuPolicy` has been explicitly set.
+  var hasZenzaiCpuPolicy: Bool {return _storage._zenzaiCpuPolicy != nil}
+  /// Clears the value of `zenzaiCpuPolicy`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiCpuPolicy() {_uniqueStorage()._zenzaiCpuPolicy = nil}
+
+  var zenzaiCpuAffinity: String {
+    get {return _storage._zenzaiCpuAffinity ?? String()}
+    set {_uniqueStorage()._zenzaiCpuAffinity = newValue}
+  }
+  /// Returns true if `zenzaiCpuAffinity` has been explicitly set.
+  var hasZenzaiCpuAffinity: Bool {return _storage._zenzaiCpuAffinity != nil}
+  /// Clears the value of `zenzaiCpuAffinity`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiCpuAffinity() {_uniqueStorage()._zenzaiCpuAffinity = nil}
+
+  var zenzaiLatencyTargetMs: Int32 {
+    get {return _storage._zenzaiLatencyTargetMs ?? 0}
+    set {_uniqueStorage()._zenzaiLatencyTargetMs = newValue}
+  }
+  /// Returns true if `zenzaiLatencyTargetMs` has been explicitly set.
+  var hasZenzaiLatencyTargetMs: Bool {return _storage._zenzaiLatencyTargetMs != nil}
+  /// Clears the value of `zenzaiLatencyTargetMs`. Subsequent reads from it will return its default value.
+  mutating func clearZenzaiLatencyTargetMs() {_uniqueStorage()._zenzaiLatencyTargetMs = nil}
+
   var zenzaiProfile: String {
     get {return _storage._zenzaiProfile ?? String()}
     set {_uniqueStorage()._zenzaiProfile = newValue}
@@ -539,6 +647,48 @@ struct Hazkey_Config_Profile: @unchecked Sendable {
 
   }
 
+  enum ZenzaiCpuPolicy: SwiftProtobuf.Enum, Swift.CaseIterable {
+    typealias RawValue = Int
+    case unspecified // = 0
+    case zenzaiCpuAllCores // = 1
+    case zenzaiCpuPerformanceCores // = 2
+    case zenzaiCpuCustomAffinity // = 3
+    case UNRECOGNIZED(Int)
+
+    init() {
+      self = .unspecified
+    }
+
+    init?(rawValue: Int) {
+      switch rawValue {
+      case 0: self = .unspecified
+      case 1: self = .zenzaiCpuAllCores
+      case 2: self = .zenzaiCpuPerformanceCores
+      case 3: self = .zenzaiCpuCustomAffinity
+      default: self = .UNRECOGNIZED(rawValue)
+      }
+    }
+
+    var rawValue: Int {
+      switch self {
+      case .unspecified: return 0
+      case .zenzaiCpuAllCores: return 1
+      case .zenzaiCpuPerformanceCores: return 2
+      case .zenzaiCpuCustomAffinity: return 3
+      case .UNRECOGNIZED(let i): return i
+      }
+    }
+
+    // The compiler won't synthesize support with the UNRECOGNIZED case.
+    static let allCases: [Hazkey_Config_Profile.ZenzaiCpuPolicy] = [
+      .unspecified,
+      .zenzaiCpuAllCores,
+      .zenzaiCpuPerformanceCores,
+      .zenzaiCpuCustomAffinity,
+    ]
+
+  }
+
   struct SpecialConversionMode: Sendable {
     // SwiftProtobuf.Message conformance is added in an extension below. See the
     // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
@@ -625,6 +775,15 @@ struct Hazkey_Config_Profile: @unchecked Sendable {
     /// Clears the value of `extendedEmoji`. Subsequent reads from it will return its default value.
     mutating func clearExtendedEmoji() {self._extendedEmoji = nil}
 
+    var typoCorrection: Bool {
+      get {return _typoCorrection ?? false}
+      set {_typoCorrection = newValue}
+    }
+    /// Returns true if `typoCorrection` has been explicitly set.
+    var hasTypoCorrection: Bool {return self._typoCorrection != nil}
+    /// Clears the value of `typoCorrection`. Subsequent reads from it will return its default value.
+    mutating func clearTypoCorrection() {self._typoCorrection = nil}
+
     var unknownFields = SwiftProtobuf.UnknownStorage()
 
     init() {}
@@ -638,6 +797,7 @@ struct Hazkey_Config_Profile: @unchecked Sendable {
     fileprivate var _hazkeyVersion: Bool? = nil
     fileprivate var _halfwidthKatakana: Bool? = nil
     fileprivate var _extendedEmoji: Bool? = nil
+    fileprivate var _typoCorrection: Bool? = nil
   }
 
   struct EnabledKeymap: Sendable {
@@ -783,6 +943,20 @@ struct Hazkey_Config_ReloadZenzaiModel: Sendable {
   init() {}
 }
 
+struct Hazkey_Config_BenchmarkZenzai: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  var start: Bool = false
+
+  var applyFastest: Bool = false
+
+  var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  init() {}
+}
+
 struct Hazkey_Config_CurrentConfig: Sendable {
   // SwiftProtobuf.Message conformance is added in an extension below. See the
   // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
@@ -802,6 +976,10 @@ struct Hazkey_Config_CurrentConfig: Sendable {
 
   var zenzaiModelPath: String = String()
 
+  var zenzaiDraftModelAvailable: Bool = false
+
+  var englishLexiconAvailable: Bool = false
+
   var xdgConfigHomePath: String = String()
 
   var unknownFields = SwiftProtobuf.UnknownStorage()
@@ -809,6 +987,56 @@ struct Hazkey_Config_CurrentConfig: Sendable {
   init() {}
 }
 
+struct Hazkey_Config_ZenzaiBenchmarkResult: Sendable {
+  // SwiftProtobuf.Message conformance is added in an extension below. See the
+  // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+  // methods supported on all messages.
+
+  var running: Bool = false
+
+  var results: [Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult] = []
+
+  var fastestDeviceName: String = String()
+
+  var applied: Bool = false
+
+  var errorMessage: String = String()
+
+  var fastestThreads: Int32 = 0
+
+  var unknownFields = SwiftProtobuf.UnknownStorage()
+
+  struct DeviceResult: Sendable {
+    // SwiftProtobuf.Message conformance is added in an extension below. See the
+    // `Message` and `Message+*Additions` files in the SwiftProtobuf library for
+    // methods supported on all messages.
+
+    var deviceName: String = String()
+
+    var deviceDesc: String = String()
+
+    var conversions: Int32 = 0
+
+    var meanLatencyMs: Double = 0
+
+    var maxLatencyMs: Double = 0
+
+    var charsPerSecond: Double = 0
+
+    var draftMeanLatencyMs: Double = 0
+
+    var draftCharsPerSecond: Double = 0
+
+    var threads: Int32 = 0
+
+    var unknownFields = SwiftProtobuf.UnknownStorage()
+
+    init() {}
+  }
+
+  init() {}
+}
+
 // MARK: - Code below here is support for the SwiftProtobuf runtime.
 
 fileprivate let _protobuf_package = "hazkey.config"
@@ -1002,6 +1230,7 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
     13: .standard(proto: "suggestion_list_mode"),
     14: .standard(proto: "use_rich_suggestion"),
     15: .standard(proto: "num_suggestions"),
+    16: .standard(proto: "use_english_prediction"),
     20: .standard(proto: "use_default_conversion_ui_settings"),
     21: .standard(proto: "num_candidates_per_page"),
     22: .standard(proto: "use_rich_candidates"),
@@ -1020,9 +1249,20 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
     101: .standard(proto: "zenzai_enable"),
     102: .standard(proto: "zenzai_infer_limit"),
     103: .standard(proto: "zenzai_contextual_mode"),
+    104: .standard(proto: "zenzai_time_budget_ms"),
     105: .standard(proto: "use_zenzai_custom_weight"),
     106: .standard(proto: "zenzai_weight_path"),
     107: .standard(proto: "zenzai_backend_device_name"),
+    108: .standard(proto: "zenzai_isolated_worker"),
+    109: .standard(proto: "zenzai_worker_timeout_ms"),
+    110: .standard(proto: "zenzai_worker_memory_limit_mb"),
+    111: .standard(proto: "zenzai_use_draft_model"),
+    112: .standard(proto: "zenzai_persist_score_cache"),
+    113: .standard(proto: "zenzai_idle_unload_minutes"),
+    114: .standard(proto: "zenzai_threads"),
+    115: .standard(proto: "zenzai_cpu_policy"),
+    116: .standard(proto: "zenzai_cpu_affinity"),
+    117: .standard(proto: "zenzai_latency_target_ms"),
     120: .standard(proto: "zenzai_profile"),
     121: .standard(proto: "zenzai_topic"),
     122: .standard(proto: "zenzai_style"),
@@ -1039,6 +1279,7 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
     var _suggestionListMode: Hazkey_Config_Profile.SuggestionListMode? = nil
     var _useRichSuggestion: Bool? = nil
     var _numSuggestions: Int32? = nil
+    var _useEnglishPrediction: Bool? = nil
     var _useDefaultConversionUiSettings: Bool? = nil
     var _numCandidatesPerPage: Int32? = nil
     var _useRichCandidates: Bool? = nil
@@ -1057,9 +1298,20 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
     var _zenzaiEnable: Bool? = nil
     var _zenzaiInferLimit: Int32? = nil
     var _zenzaiContextualMode: Bool? = nil
+    var _zenzaiTimeBudgetMs: Int32? = nil
     var _useZenzaiCustomWeight: Bool? = nil
     var _zenzaiWeightPath: String? = nil
     var _zenzaiBackendDeviceName: String? = nil
+    var _zenzaiIsolatedWorker: Bool? = nil
+    var _zenzaiWorkerTimeoutMs: Int32? = nil
+    var _zenzaiWorkerMemoryLimitMb: Int32? = nil
+    var _zenzaiUseDraftModel: Bool? = nil
+    var _zenzaiPersistScoreCache: Bool? = nil
+    var _zenzaiIdleUnloadMinutes: Int32? = nil
+    var _zenzaiThreads: Int32? = nil
+    var _zenzaiCpuPolicy: Hazkey_Config_Profile.ZenzaiCpuPolicy? = nil
+    var _zenzaiCpuAffinity: String? = nil
+    var _zenzaiLatencyTargetMs: Int32? = nil
     var _zenzaiProfile: String? = nil
     var _zenzaiTopic: String? = nil
     var _zenzaiStyle: String? = nil
@@ -1083,6 +1335,7 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
       _suggestionListMode = source._suggestionListMode
       _useRichSuggestion = source._useRichSuggestion
       _numSuggestions = source._numSuggestions
+      _useEnglishPrediction = source._useEnglishPrediction
       _useDefaultConversionUiSettings = source._useDefaultConversionUiSettings
       _numCandidatesPerPage = source._numCandidatesPerPage
       _useRichCandidates = source._useRichCandidates
@@ -1101,9 +1354,20 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
       _zenzaiEnable = source._zenzaiEnable
       _zenzaiInferLimit = source._zenzaiInferLimit
       _zenzaiContextualMode = source._zenzaiContextualMode
+      _zenzaiTimeBudgetMs = source._zenzaiTimeBudgetMs
       _useZenzaiCustomWeight = source._useZenzaiCustomWeight
       _zenzaiWeightPath = source._zenzaiWeightPath
       _zenzaiBackendDeviceName = source._zenzaiBackendDeviceName
+      _zenzaiIsolatedWorker = source._zenzaiIsolatedWorker
+      _zenzaiWorkerTimeoutMs = source._zenzaiWorkerTimeoutMs
+      _zenzaiWorkerMemoryLimitMb = source._zenzaiWorkerMemoryLimitMb
+      _zenzaiUseDraftModel = source._zenzaiUseDraftModel
+      _zenzaiPersistScoreCache = source._zenzaiPersistScoreCache
+      _zenzaiIdleUnloadMinutes = source._zenzaiIdleUnloadMinutes
+      _zenzaiThreads = source._zenzaiThreads
+      _zenzaiCpuPolicy = source._zenzaiCpuPolicy
+      _zenzaiCpuAffinity = source._zenzaiCpuAffinity
+      _zenzaiLatencyTargetMs = source._zenzaiLatencyTargetMs
       _zenzaiProfile = source._zenzaiProfile
       _zenzaiTopic = source._zenzaiTopic
       _zenzaiStyle = source._zenzaiStyle
@@ -1135,6 +1399,7 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
         case 13: try { try decoder.decodeSingularEnumField(value: &_storage._suggestionListMode) }()
         case 14: try { try decoder.decodeSingularBoolField(value: &_storage._useRichSuggestion) }()
         case 15: try { try decoder.decodeSingularInt32Field(value: &_storage._numSuggestions) }()
+        case 16: try { try decoder.decodeSingularBoolField(value: &_storage._useEnglishPrediction) }()
         case 20: try { try decoder.decodeSingularBoolField(value: &_storage._useDefaultConversionUiSettings) }()
         case 21: try { try decoder.decodeSingularInt32Field(value: &_storage._numCandidatesPerPage) }()
         case 22: try { try decoder.decodeSingularBoolField(value: &_storage._useRichCandidates) }()
@@ -1153,9 +1418,20 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
         case 101: try { try decoder.decodeSingularBoolField(value: &_storage._zenzaiEnable) }()
         case 102: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiInferLimit) }()
         case 103: try { try decoder.decodeSingularBoolField(value: &_storage._zenzaiContextualMode) }()
+        case 104: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiTimeBudgetMs) }()
         case 105: try { try decoder.decodeSingularBoolField(value: &_storage._useZenzaiCustomWeight) }()
         case 106: try { try decoder.decodeSingularStringField(value: &_storage._zenzaiWeightPath) }()
         case 107: try { try decoder.decodeSingularStringField(value: &_storage._zenzaiBackendDeviceName) }()
+        case 108: try { try decoder.decodeSingularBoolField(value: &_storage._zenzaiIsolatedWorker) }()
+        case 109: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiWorkerTimeoutMs) }()
+        case 110: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiWorkerMemoryLimitMb) }()
+        case 111: try { try decoder.decodeSingularBoolField(value: &_storage._zenzaiUseDraftModel) }()
+        case 112: try { try decoder.decodeSingularBoolField(value: &_storage._zenzaiPersistScoreCache) }()
+        case 113: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiIdleUnloadMinutes) }()
+        case 114: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiThreads) }()
+        case 115: try { try decoder.decodeSingularEnumField(value: &_storage._zenzaiCpuPolicy) }()
+        case 116: try { try decoder.decodeSingularStringField(value: &_storage._zenzaiCpuAffinity) }()
+        case 117: try { try decoder.decodeSingularInt32Field(value: &_storage._zenzaiLatencyTargetMs) }()
         case 120: try { try decoder.decodeSingularStringField(value: &_storage._zenzaiProfile) }()
         case 121: try { try decoder.decodeSingularStringField(value: &_storage._zenzaiTopic) }()
         case 122: try { try decoder.decodeSingularStringField(value: &_storage._zenzaiStyle) }()
@@ -1199,6 +1475,9 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
       try { if let v = _storage._numSuggestions {
         try visitor.visitSingularInt32Field(value: v, fieldNumber: 15)
       } }()
+      try { if let v = _storage._useEnglishPrediction {
+        try visitor.visitSingularBoolField(value: v, fieldNumber: 16)
+      } }()
       try { if let v = _storage._useDefaultConversionUiSettings {
         try visitor.visitSingularBoolField(value: v, fieldNumber: 20)
       } }()
@@ -1253,6 +1532,9 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
       try { if let v = _storage._zenzaiContextualMode {
         try visitor.visitSingularBoolField(value: v, fieldNumber: 103)
       } }()
+      try { if let v = _storage._zenzaiTimeBudgetMs {
+        try visitor.visitSingularInt32Field(value: v, fieldNumber: 104)
+      } }()
       try { if let v = _storage._useZenzaiCustomWeight {
         try visitor.visitSingularBoolField(value: v, fieldNumber: 105)
       } }()
@@ -1262,6 +1544,36 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
       try { if let v = _storage._zenzaiBackendDeviceName {
         try visitor.visitSingularStringField(value: v, fieldNumber: 107)
       } }()
+      try { if let v = _storage._zenzaiIsolatedWorker {
+        try visitor.visitSingularBoolField(value: v, fieldNumber: 108)
+      } }()
+      try { if let v = _storage._zenzaiWorkerTimeoutMs {
+        try visitor.visitSingularInt32Field(value: v, fieldNumber: 109)
+      } }()
+      try { if let v = _storage._zenzaiWorkerMemoryLimitMb {
+        try visitor.visitSingularInt32Field(value: v, fieldNumber: 110)
+      } }()
+      try { if let v = _storage._zenzaiUseDraftModel {
+        try visitor.visitSingularBoolField(value: v, fieldNumber: 111)
+      } }()
+      try { if let v = _storage._zenzaiPersistScoreCache {
+        try visitor.visitSingularBoolField(value: v, fieldNumber: 112)
+      } }()
+      try { if let v = _storage._zenzaiIdleUnloadMinutes {
+        try visitor.visitSingularInt32Field(value: v, fieldNumber: 113)
+      } }()
+      try { if let v = _storage._zenzaiThreads {
+        try visitor.visitSingularInt32Field(value: v, fieldNumber: 114)
+      } }()
+      try { if let v = _storage._zenzaiCpuPolicy {
+        try visitor.visitSingularEnumField(value: v, fieldNumber: 115)
+      } }()
+      try { if let v = _storage._zenzaiCpuAffinity {
+        try visitor.visitSingularStringField(value: v, fieldNumber: 116)
+      } }()
+      try { if let v = _storage._zenzaiLatencyTargetMs {
+        try visitor.visitSingularInt32Field(value: v, fieldNumber: 117)
+      } }()
       try { if let v = _storage._zenzaiProfile {
         try visitor.visitSingularStringField(value: v, fieldNumber: 120)
       } }()
@@ -1292,6 +1604,7 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
         if _storage._suggestionListMode != rhs_storage._suggestionListMode {return false}
         if _storage._useRichSuggestion != rhs_storage._useRichSuggestion {return false}
         if _storage._numSuggestions != rhs_storage._numSuggestions {return false}
+        if _storage._useEnglishPrediction != rhs_storage._useEnglishPrediction {return false}
         if _storage._useDefaultConversionUiSettings != rhs_storage._useDefaultConversionUiSettings {return false}
         if _storage._numCandidatesPerPage != rhs_storage._numCandidatesPerPage {return false}
         if _storage._useRichCandidates != rhs_storage._useRichCandidates {return false}
@@ -1310,9 +1623,20 @@ extension Hazkey_Config_Profile: SwiftProtobuf.Message, SwiftProtobuf._MessageIm
         if _storage._zenzaiEnable != rhs_storage._zenzaiEnable {return false}
         if _storage._zenzaiInferLimit != rhs_storage._zenzaiInferLimit {return false}
         if _storage._zenzaiContextualMode != rhs_storage._zenzaiContextualMode {return false}
+        if _storage._zenzaiTimeBudgetMs != rhs_storage._zenzaiTimeBudgetMs {return false}
         if _storage._useZenzaiCustomWeight != rhs_storage._useZenzaiCustomWeight {return false}
         if _storage._zenzaiWeightPath != rhs_storage._zenzaiWeightPath {return false}
         if _storage._zenzaiBackendDeviceName != rhs_storage._zenzaiBackendDeviceName {return false}
+        if _storage._zenzaiIsolatedWorker != rhs_storage._zenzaiIsolatedWorker {return false}
+        if _storage._zenzaiWorkerTimeoutMs != rhs_storage._zenzaiWorkerTimeoutMs {return false}
+        if _storage._zenzaiWorkerMemoryLimitMb != rhs_storage._zenzaiWorkerMemoryLimitMb {return false}
+        if _storage._zenzaiUseDraftModel != rhs_storage._zenzaiUseDraftModel {return false}
+        if _storage._zenzaiPersistScoreCache != rhs_storage._zenzaiPersistScoreCache {return false}
+        if _storage._zenzaiIdleUnloadMinutes != rhs_storage._zenzaiIdleUnloadMinutes {return false}
+        if _storage._zenzaiThreads != rhs_storage._zenzaiThreads {return false}
+        if _storage._zenzaiCpuPolicy != rhs_storage._zenzaiCpuPolicy {return false}
+        if _storage._zenzaiCpuAffinity != rhs_storage._zenzaiCpuAffinity {return false}
+        if _storage._zenzaiLatencyTargetMs != rhs_storage._zenzaiLatencyTargetMs {return false}
         if _storage._zenzaiProfile != rhs_storage._zenzaiProfile {return false}
         if _storage._zenzaiTopic != rhs_storage._zenzaiTopic {return false}
         if _storage._zenzaiStyle != rhs_storage._zenzaiStyle {return false}
@@ -1353,6 +1677,15 @@ extension Hazkey_Config_Profile.SuggestionListMode: SwiftProtobuf._ProtoNameProv
   ]
 }
 
+extension Hazkey_Config_Profile.ZenzaiCpuPolicy: SwiftProtobuf._ProtoNameProviding {
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    0: .same(proto: "ZENZAI_CPU_POLICY_UNSPECIFIED"),
+    1: .same(proto: "ZENZAI_CPU_ALL_CORES"),
+    2: .same(proto: "ZENZAI_CPU_PERFORMANCE_CORES"),
+    3: .same(proto: "ZENZAI_CPU_CUSTOM_AFFINITY"),
+  ]
+}
+
 extension Hazkey_Config_Profile.SpecialConversionMode: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   static let protoMessageName: String = Hazkey_Config_Profile.protoMessageName + ".SpecialConversionMode"
   static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
@@ -1365,6 +1698,7 @@ extension Hazkey_Config_Profile.SpecialConversionMode: SwiftProtobuf.Message, Sw
     7: .standard(proto: "hazkey_version"),
     50: .standard(proto: "halfwidth_katakana"),
     51: .standard(proto: "extended_emoji"),
+    52: .standard(proto: "typo_correction"),
   ]
 
   mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
@@ -1382,6 +1716,7 @@ extension Hazkey_Config_Profile.SpecialConversionMode: SwiftProtobuf.Message, Sw
       case 7: try { try decoder.decodeSingularBoolField(value: &self._hazkeyVersion) }()
       case 50: try { try decoder.decodeSingularBoolField(value: &self._halfwidthKatakana) }()
       case 51: try { try decoder.decodeSingularBoolField(value: &self._extendedEmoji) }()
+      case 52: try { try decoder.decodeSingularBoolField(value: &self._typoCorrection) }()
       default: break
       }
     }
@@ -1419,6 +1754,9 @@ extension Hazkey_Config_Profile.SpecialConversionMode: SwiftProtobuf.Message, Sw
     try { if let v = self._extendedEmoji {
       try visitor.visitSingularBoolField(value: v, fieldNumber: 51)
     } }()
+    try { if let v = self._typoCorrection {
+      try visitor.visitSingularBoolField(value: v, fieldNumber: 52)
+    } }()
     try unknownFields.traverse(visitor: &visitor)
   }
 
@@ -1432,6 +1770,7 @@ extension Hazkey_Config_Profile.SpecialConversionMode: SwiftProtobuf.Message, Sw
     if lhs._hazkeyVersion != rhs._hazkeyVersion {return false}
     if lhs._halfwidthKatakana != rhs._halfwidthKatakana {return false}
     if lhs._extendedEmoji != rhs._extendedEmoji {return false}
+    if lhs._typoCorrection != rhs._typoCorrection {return false}
     if lhs.unknownFields != rhs.unknownFields {return false}
     return true
   }
@@ -1660,6 +1999,44 @@ extension Hazkey_Config_ReloadZenzaiModel: SwiftProtobuf.Message, SwiftProtobuf.
   }
 }
 
+extension Hazkey_Config_BenchmarkZenzai: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = _protobuf_package + ".BenchmarkZenzai"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "start"),
+    2: .standard(proto: "apply_fastest"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularBoolField(value: &self.start) }()
+      case 2: try { try decoder.decodeSingularBoolField(value: &self.applyFastest) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.start != false {
+      try visitor.visitSingularBoolField(value: self.start, fieldNumber: 1)
+    }
+    if self.applyFastest != false {
+      try visitor.visitSingularBoolField(value: self.applyFastest, fieldNumber: 2)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Config_BenchmarkZenzai, rhs: Hazkey_Config_BenchmarkZenzai) -> Bool {
+    if lhs.start != rhs.start {return false}
+    if lhs.applyFastest != rhs.applyFastest {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
 extension Hazkey_Config_CurrentConfig: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
   static let protoMessageName: String = _protobuf_package + ".CurrentConfig"
   static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
@@ -1670,6 +2047,8 @@ extension Hazkey_Config_CurrentConfig: SwiftProtobuf.Message, SwiftProtobuf._Mes
     7: .standard(proto: "available_zenzai_backend_devices"),
     8: .standard(proto: "zenzai_model_available"),
     9: .standard(proto: "zenzai_model_path"),
+    10: .standard(proto: "zenzai_draft_model_available"),
+    11: .standard(proto: "english_lexicon_available"),
     6: .standard(proto: "xdg_config_home_path"),
   ]
 
@@ -1687,6 +2066,8 @@ extension Hazkey_Config_CurrentConfig: SwiftProtobuf.Message, SwiftProtobuf._Mes
       case 7: try { try decoder.decodeRepeatedMessageField(value: &self.availableZenzaiBackendDevices) }()
       case 8: try { try decoder.decodeSingularBoolField(value: &self.zenzaiModelAvailable) }()
       case 9: try { try decoder.decodeSingularStringField(value: &self.zenzaiModelPath) }()
+      case 10: try { try decoder.decodeSingularBoolField(value: &self.zenzaiDraftModelAvailable) }()
+      case 11: try { try decoder.decodeSingularBoolField(value: &self.englishLexiconAvailable) }()
       default: break
       }
     }
@@ -1717,6 +2098,12 @@ extension Hazkey_Config_CurrentConfig: SwiftProtobuf.Message, SwiftProtobuf._Mes
     if !self.zenzaiModelPath.isEmpty {
       try visitor.visitSingularStringField(value: self.zenzaiModelPath, fieldNumber: 9)
     }
+    if self.zenzaiDraftModelAvailable != false {
+      try visitor.visitSingularBoolField(value: self.zenzaiDraftModelAvailable, fieldNumber: 10)
+    }
+    if self.englishLexiconAvailable != false {
+      try visitor.visitSingularBoolField(value: self.englishLexiconAvailable, fieldNumber: 11)
+    }
     try unknownFields.traverse(visitor: &visitor)
   }
 
@@ -1728,8 +2115,152 @@ extension Hazkey_Config_CurrentConfig: SwiftProtobuf.Message, SwiftProtobuf._Mes
     if lhs.availableZenzaiBackendDevices != rhs.availableZenzaiBackendDevices {return false}
     if lhs.zenzaiModelAvailable != rhs.zenzaiModelAvailable {return false}
     if lhs.zenzaiModelPath != rhs.zenzaiModelPath {return false}
+    if lhs.zenzaiDraftModelAvailable != rhs.zenzaiDraftModelAvailable {return false}
+    if lhs.englishLexiconAvailable != rhs.englishLexiconAvailable {return false}
     if lhs.xdgConfigHomePath != rhs.xdgConfigHomePath {return false}
     if lhs.unknownFields != rhs.unknownFields {return false}
     return true
   }
 }
+
+extension Hazkey_Config_ZenzaiBenchmarkResult: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = _protobuf_package + ".ZenzaiBenchmarkResult"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .same(proto: "running"),
+    2: .same(proto: "results"),
+    3: .standard(proto: "fastest_device_name"),
+    4: .same(proto: "applied"),
+    5: .standard(proto: "error_message"),
+    6: .standard(proto: "fastest_threads"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularBoolField(value: &self.running) }()
+      case 2: try { try decoder.decodeRepeatedMessageField(value: &self.results) }()
+      case 3: try { try decoder.decodeSingularStringField(value: &self.fastestDeviceName) }()
+      case 4: try { try decoder.decodeSingularBoolField(value: &self.applied) }()
+      case 5: try { try decoder.decodeSingularStringField(value: &self.errorMessage) }()
+      case 6: try { try decoder.decodeSingularInt32Field(value: &self.fastestThreads) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if self.running != false {
+      try visitor.visitSingularBoolField(value: self.running, fieldNumber: 1)
+    }
+    if !self.results.isEmpty {
+      try visitor.visitRepeatedMessageField(value: self.results, fieldNumber: 2)
+    }
+    if !self.fastestDeviceName.isEmpty {
+      try visitor.visitSingularStringField(value: self.fastestDeviceName, fieldNumber: 3)
+    }
+    if self.applied != false {
+      try visitor.visitSingularBoolField(value: self.applied, fieldNumber: 4)
+    }
+    if !self.errorMessage.isEmpty {
+      try visitor.visitSingularStringField(value: self.errorMessage, fieldNumber: 5)
+    }
+    if self.fastestThreads != 0 {
+      try visitor.visitSingularInt32Field(value: self.fastestThreads, fieldNumber: 6)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Config_ZenzaiBenchmarkResult, rhs: Hazkey_Config_ZenzaiBenchmarkResult) -> Bool {
+    if lhs.running != rhs.running {return false}
+    if lhs.results != rhs.results {return false}
+    if lhs.fastestDeviceName != rhs.fastestDeviceName {return false}
+    if lhs.applied != rhs.applied {return false}
+    if lhs.errorMessage != rhs.errorMessage {return false}
+    if lhs.fastestThreads != rhs.fastestThreads {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
+
+extension Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult: SwiftProtobuf.Message, SwiftProtobuf._MessageImplementationBase, SwiftProtobuf._ProtoNameProviding {
+  static let protoMessageName: String = Hazkey_Config_ZenzaiBenchmarkResult.protoMessageName + ".DeviceResult"
+  static let _protobuf_nameMap: SwiftProtobuf._NameMap = [
+    1: .standard(proto: "device_name"),
+    2: .standard(proto: "device_desc"),
+    3: .same(proto: "conversions"),
+    4: .standard(proto: "mean_latency_ms"),
+    5: .standard(proto: "max_latency_ms"),
+    6: .standard(proto: "chars_per_second"),
+    7: .standard(proto: "draft_mean_latency_ms"),
+    8: .standard(proto: "draft_chars_per_second"),
+    9: .same(proto: "threads"),
+  ]
+
+  mutating func decodeMessage<D: SwiftProtobuf.Decoder>(decoder: inout D) throws {
+    while let fieldNumber = try decoder.nextFieldNumber() {
+      // The use of inline closures is to circumvent an issue where the compiler
+      // allocates stack space for every case branch when no optimizations are
+      // enabled. https://github.com/apple/swift-protobuf/issues/1034
+      switch fieldNumber {
+      case 1: try { try decoder.decodeSingularStringField(value: &self.deviceName) }()
+      case 2: try { try decoder.decodeSingularStringField(value: &self.deviceDesc) }()
+      case 3: try { try decoder.decodeSingularInt32Field(value: &self.conversions) }()
+      case 4: try { try decoder.decodeSingularDoubleField(value: &self.meanLatencyMs) }()
+      case 5: try { try decoder.decodeSingularDoubleField(value: &self.maxLatencyMs) }()
+      case 6: try { try decoder.decodeSingularDoubleField(value: &self.charsPerSecond) }()
+      case 7: try { try decoder.decodeSingularDoubleField(value: &self.draftMeanLatencyMs) }()
+      case 8: try { try decoder.decodeSingularDoubleField(value: &self.draftCharsPerSecond) }()
+      case 9: try { try decoder.decodeSingularInt32Field(value: &self.threads) }()
+      default: break
+      }
+    }
+  }
+
+  func traverse<V: SwiftProtobuf.Visitor>(visitor: inout V) throws {
+    if !self.deviceName.isEmpty {
+      try visitor.visitSingularStringField(value: self.deviceName, fieldNumber: 1)
+    }
+    if !self.deviceDesc.isEmpty {
+      try visitor.visitSingularStringField(value: self.deviceDesc, fieldNumber: 2)
+    }
+    if self.conversions != 0 {
+      try visitor.visitSingularInt32Field(value: self.conversions, fieldNumber: 3)
+    }
+    if self.meanLatencyMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.meanLatencyMs, fieldNumber: 4)
+    }
+    if self.maxLatencyMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.maxLatencyMs, fieldNumber: 5)
+    }
+    if self.charsPerSecond != 0 {
+      try visitor.visitSingularDoubleField(value: self.charsPerSecond, fieldNumber: 6)
+    }
+    if self.draftMeanLatencyMs != 0 {
+      try visitor.visitSingularDoubleField(value: self.draftMeanLatencyMs, fieldNumber: 7)
+    }
+    if self.draftCharsPerSecond != 0 {
+      try visitor.visitSingularDoubleField(value: self.draftCharsPerSecond, fieldNumber: 8)
+    }
+    if self.threads != 0 {
+      try visitor.visitSingularInt32Field(value: self.threads, fieldNumber: 9)
+    }
+    try unknownFields.traverse(visitor: &visitor)
+  }
+
+  static func ==(lhs: Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult, rhs: Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult) -> Bool {
+    if lhs.deviceName != rhs.deviceName {return false}
+    if lhs.deviceDesc != rhs.deviceDesc {return false}
+    if lhs.conversions != rhs.conversions {return false}
+    if lhs.meanLatencyMs != rhs.meanLatencyMs {return false}
+    if lhs.maxLatencyMs != rhs.maxLatencyMs {return false}
+    if lhs.charsPerSecond != rhs.charsPerSecond {return false}
+    if lhs.draftMeanLatencyMs != rhs.draftMeanLatencyMs {return false}
+    if lhs.draftCharsPerSecond != rhs.draftCharsPerSecond {return false}
+    if lhs.threads != rhs.threads {return false}
+    if lhs.unknownFields != rhs.unknownFields {return false}
+    return true
+  }
+}
@@ -0,0 +1,47 @@
+import Foundation
+import KanaKanjiConverterModule
+
+/// The merged keymap compiled for one input table.
+///
+/// Each keystroke becomes an input element, whose piece comes from the
+/// keymap and whose input style names the table. Both only change with the
+/// configuration, so the elements of the ASCII keys, which are nearly all
+/// of the typing, are made once into a flat array indexed by the key. Other
+/// keys, such as those of a kana keyboard, still look up the keymap.
+struct CompiledKeymap {
+    let keymap: Keymap
+    let tableName: String
+    private let asciiElements: [ComposingText.InputElement]
+
+    init(keymap: Keymap, tableName: String) {
+        self.keymap = keymap
+        self.tableName = tableName
+        self.asciiElements = (0..<128).map { value in
+            Self.lookUp(
+                Character(Unicode.Scalar(UInt8(value))), keymap: keymap, tableName: tableName)
+        }
+    }
+
+    func inputElement(for key: Character) -> ComposingText.InputElement {
+        // a character of one UTF-8 byte is ASCII
+        let utf8 = key.utf8
+        if utf8.count == 1, let value = utf8.first {
+            return asciiElements[Int(value)]
+        }
+        return Self.lookUp(key, keymap: keymap, tableName: tableName)
+    }
+
+    /// The input element of `key`, looked up in the keymap
+    static func lookUp(
+        _ key: Character, keymap: Keymap, tableName: String
+    ) -> ComposingText.InputElement {
+        let piece: InputPiece
+        if let (intentionChar, overrideInputChar) = keymap[key] {
+            piece = .key(intention: intentionChar, input: overrideInputChar ?? key, modifiers: [])
+        } else {
+            piece = .character(key)
+        }
+        return ComposingText.InputElement(
+            piece: piece, inputStyle: .mapped(id: .tableName(tableName)))
+    }
+}
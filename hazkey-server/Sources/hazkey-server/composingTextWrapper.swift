@@ -1,8 +1,63 @@
 import KanaKanjiConverterModule
 
+/// The composing text of the server state.
+///
+/// Its hiragana form and the string index of each of its characters are
+/// kept until the text changes, so that the length and slices at character
+/// offsets, which every keystroke asks for, are not recounted from the start.
 final class ComposingTextBox {
-    public var value: ComposingText
+    public var value: ComposingText {
+        didSet {
+            indexedHiragana = nil
+            completedReading = nil
+        }
+    }
+
+    private var indexedHiragana: (text: String, indices: [String.Index])?
+    private var completedReading: (text: ComposingText, hiragana: String)?
+
     init() {
         self.value = ComposingText()
     }
+
+    var hiragana: String {
+        return indexHiragana().text
+    }
+
+    /// The number of characters of `hiragana`
+    var hiraganaCount: Int {
+        return indexHiragana().indices.count - 1
+    }
+
+    /// The characters of `hiragana` in `start..<end`, clamped to its length.
+    func hiragana(from start: Int, to end: Int) -> Substring {
+        let (text, indices) = indexHiragana()
+        let start = min(max(start, 0), indices.count - 1)
+        let end = min(max(end, start), indices.count - 1)
+        return text[indices[start]..<indices[end]]
+    }
+
+    /// `value` completed by `complete`, which is called once per change of
+    /// `value`, together with its hiragana form.
+    func completed(
+        by complete: (ComposingText) -> ComposingText
+    ) -> (text: ComposingText, hiragana: String) {
+        if let completedReading {
+            return completedReading
+        }
+        let text = complete(value)
+        let reading = (text, text.toHiragana())
+        completedReading = reading
+        return reading
+    }
+
+    private func indexHiragana() -> (text: String, indices: [String.Index]) {
+        if let indexedHiragana {
+            return indexedHiragana
+        }
+        let text = value.toHiragana()
+        let indexed = (text, Array(text.indices) + [text.endIndex])
+        indexedHiragana = indexed
+        return indexed
+    }
 }
@@ -4,6 +4,8 @@ import SwiftProtobuf
 
 let KEYMAP_FILE_SIZE_LIMIT = 1024 * 1024  //1MB
 let TABLE_FILE_SIZE_LIMIT = 1024 * 1024  //1MB
+let ZENZAI_WORKER_DEFAULT_TIMEOUT_MS = 150
+let ZENZAI_IDLE_UNLOAD_DEFAULT_MINUTES = 30
 
 let builtInKeymaps = [
     "JIS Kana",
@@ -38,7 +40,15 @@ class HazkeyServerConfig {
     let dictionaryPath: URL
     var zenzaiAvailable: Bool
     var zenzaiModelPath: URL?
+    var zenzaiDraftModelPath: URL?
     var ggmlBackendDevices: [GGMLBackendDevice]
+    let ggmlBackendLoader: GGMLBackendLoader
+    let zenzaiBackendDeviceList = ZenzaiBackendDeviceList()
+    let specialProviderStats = SpecialCandidateProviderStats()
+    let zenzaiController = ZenzaiLatencyController(
+        storeURL: HazkeyServerConfig.getStateDirectory().appendingPathComponent(
+            "zenzai_tuning.json"))
+    let zenzaiBudget = ZenzaiInferenceBudget()
 
     init() {
         do {
@@ -66,9 +76,15 @@ class HazkeyServerConfig {
             }
         }()
 
-        self.ggmlBackendDevices = getZenzaiDevices()
-        zenzaiModelPath = if ggmlBackendDevices.count <= 0 { nil } else { getZenzaiModelPath() }
-        self.zenzaiAvailable = (ggmlBackendDevices.count > 0) && (zenzaiModelPath != nil)
+        // must precede loading the CPU backend, which reads it once. The server
+        // and each Zenzai worker set it here at startup, while nothing else runs
+        applyZenzaiThreadEnvironment(currentProfile)
+        self.ggmlBackendLoader = GGMLBackendLoader()
+        self.ggmlBackendDevices = []
+        self.zenzaiModelPath = nil
+        self.zenzaiDraftModelPath = nil
+        self.zenzaiAvailable = false
+        reloadZenzaiModel()
     }
 
     func getCurrentConfig() -> Hazkey_ResponseEnvelope {
@@ -157,7 +173,7 @@ class HazkeyServerConfig {
         }
 
         var zenzaiDevices: [Hazkey_Config_BackendDevice] = []
-        for devices in ggmlBackendDevices {
+        for devices in zenzaiBackendDeviceList.devices {
             zenzaiDevices.append(
                 Hazkey_Config_BackendDevice.with {
                     $0.name = devices.name
@@ -170,6 +186,8 @@ class HazkeyServerConfig {
             $0.fileHashes = []
             $0.zenzaiModelAvailable = zenzaiModelPath != nil
             $0.zenzaiModelPath = zenzaiModelPath?.path ?? ""
+            $0.zenzaiDraftModelAvailable = zenzaiDraftModelPath != nil
+            $0.englishLexiconAvailable = getEnglishLexiconPath() != nil
             $0.xdgConfigHomePath = Self.getConfigDirectory().path
             $0.availableKeymaps = keymaps
             $0.availableTables = inputTables
@@ -210,6 +228,7 @@ class HazkeyServerConfig {
         newConf.suggestionListMode =
             Hazkey_Config_Profile.SuggestionListMode.suggestionListShowPredictiveResults
         newConf.numSuggestions = 3
+        newConf.useEnglishPrediction = false
         newConf.useRichSuggestion = false
         newConf.numCandidatesPerPage = 9
         newConf.useRichCandidates = false
@@ -224,6 +243,7 @@ class HazkeyServerConfig {
             $0.hazkeyVersion = true
             $0.halfwidthKatakana = true
             $0.extendedEmoji = true
+            $0.typoCorrection = false
         }
         newConf.stopStoreNewHistory = false
         newConf.enabledKeymaps = [
@@ -259,7 +279,18 @@ class HazkeyServerConfig {
         newConf.zenzaiBackendDeviceName = "CPU"
         newConf.zenzaiEnable = true
         newConf.zenzaiInferLimit = 10
+        newConf.zenzaiTimeBudgetMs = 0
+        newConf.zenzaiLatencyTargetMs = 0
         newConf.zenzaiContextualMode = true
+        newConf.zenzaiIsolatedWorker = false
+        newConf.zenzaiWorkerTimeoutMs = Int32(ZENZAI_WORKER_DEFAULT_TIMEOUT_MS)
+        newConf.zenzaiWorkerMemoryLimitMb = 0
+        newConf.zenzaiUseDraftModel = false
+        newConf.zenzaiPersistScoreCache = false
+        newConf.zenzaiIdleUnloadMinutes = Int32(ZENZAI_IDLE_UNLOAD_DEFAULT_MINUTES)
+        newConf.zenzaiThreads = 0
+        newConf.zenzaiCpuPolicy = .zenzaiCpuAllCores
+        newConf.zenzaiCpuAffinity = ""
         newConf.zenzaiProfile = ""
         return newConf
     }
@@ -293,6 +324,7 @@ class HazkeyServerConfig {
 
         profiles = newProfiles
         currentProfile = profiles[0]
+        reloadZenzaiModel()
 
         if let state = state {
             state.reinitializeConfiguration()
@@ -385,17 +417,92 @@ class HazkeyServerConfig {
         return homeDir.appendingPathComponent(".cache").appendingPathComponent("hazkey")
     }
 
-    func genZenzaiMode(leftContext: String)
-        -> ConvertRequestOptions.ZenzaiMode
-    {
-        let deviceName =
-            currentProfile.zenzaiBackendDeviceName.isEmpty
+    var isZenzaiEnabled: Bool {
+        return zenzaiAvailable && zenzaiModelPath != nil && currentProfile.zenzaiEnable
+    }
+
+    /// Whether live conversion uses the draft model
+    var isZenzaiDraftEnabled: Bool {
+        return isZenzaiEnabled && currentProfile.zenzaiUseDraftModel
+            && zenzaiDraftModelPath != nil
+    }
+
+    var zenzaiDeviceName: String {
+        return currentProfile.zenzaiBackendDeviceName.isEmpty
             ? "CPU" : currentProfile.zenzaiBackendDeviceName
+    }
 
-        if zenzaiAvailable, let zenzaiModelPath = zenzaiModelPath, currentProfile.zenzaiEnable {
+    /// Longest time a conversion waits for the Zenzai worker
+    var zenzaiWorkerTimeoutMs: Int {
+        let timeoutMs = Int(currentProfile.zenzaiWorkerTimeoutMs)
+        return timeoutMs > 0 ? timeoutMs : ZENZAI_WORKER_DEFAULT_TIMEOUT_MS
+    }
+
+    /// Time without conversions after which the Zenzai model is released, nil to keep it
+    var zenzaiIdleUnloadSeconds: Int? {
+        let minutes =
+            currentProfile.hasZenzaiIdleUnloadMinutes
+            ? Int(currentProfile.zenzaiIdleUnloadMinutes) : ZENZAI_IDLE_UNLOAD_DEFAULT_MINUTES
+        return minutes > 0 ? minutes * 60 : nil
+    }
+
+    /// Inference limit for the next conversion, tuned to the latency target and
+    /// reduced to fit in the time budget
+    func zenzaiInferenceLimit() -> Int {
+        let tunedLimit = zenzaiController.inferenceLimit(
+            maxLimit: Int(currentProfile.zenzaiInferLimit),
+            targetMs: Int(currentProfile.zenzaiLatencyTargetMs))
+        return zenzaiBudget.inferenceLimit(
+            maxLimit: tunedLimit, budgetMs: Int(currentProfile.zenzaiTimeBudgetMs))
+    }
+
+    /// Left context passed to Zenzai, shortened to the tuned length
+    func zenzaiLeftContext(_ leftContext: String) -> String? {
+        guard currentProfile.zenzaiContextualMode else { return nil }
+        guard
+            let length = zenzaiController.contextLength(
+                targetMs: Int(currentProfile.zenzaiLatencyTargetMs)),
+            leftContext.count > length
+        else {
+            return leftContext
+        }
+        // cut in steps of a quarter of the length, so that the start of the
+        // context, and the KV cache behind it, only changes once per step
+        let step = max(1, length / 4)
+        let dropped = (leftContext.count - length + step - 1) / step * step
+        return String(leftContext.dropFirst(dropped))
+    }
+
+    /// Identifies the model file and the prompt settings Zenzai results depend on
+    func zenzaiScoreCacheValidityKey() -> String {
+        guard let modelPath = zenzaiModelPath else { return "" }
+        let attributes = try? FileManager.default.attributesOfItem(atPath: modelPath.path)
+        let size = (attributes?[.size] as? NSNumber)?.int64Value ?? 0
+        let modified = (attributes?[.modificationDate] as? Date)?.timeIntervalSince1970 ?? 0
+        return [
+            modelPath.path, "\(size)", "\(modified)",
+            currentProfile.zenzaiProfile, currentProfile.zenzaiTopic,
+            currentProfile.zenzaiStyle, currentProfile.zenzaiPreference,
+            "\(currentProfile.zenzaiContextualMode)", "\(currentProfile.useRichCandidates)",
+        ].joined(separator: "\n")
+    }
+
+    /// Text Zenzai puts in front of the reading in its prompt
+    func zenzaiPromptPrefix(leftContext: String) -> String {
+        return currentProfile.zenzaiProfile + currentProfile.zenzaiTopic
+            + currentProfile.zenzaiStyle + currentProfile.zenzaiPreference
+            + (zenzaiLeftContext(leftContext) ?? "")
+    }
+
+    func genZenzaiMode(leftContext: String, draft: Bool = false)
+        -> ConvertRequestOptions.ZenzaiMode
+    {
+        if zenzaiAvailable, let weight = draft ? zenzaiDraftModelPath : zenzaiModelPath,
+            currentProfile.zenzaiEnable
+        {
             return ConvertRequestOptions.ZenzaiMode.on(
-                weight: zenzaiModelPath,
-                inferenceLimit: Int(currentProfile.zenzaiInferLimit),
+                weight: weight,
+                inferenceLimit: zenzaiInferenceLimit(),
                 requestRichCandidates: currentProfile.useRichCandidates,
                 personalizationMode: nil,
                 versionDependentMode: .v3(
@@ -404,10 +511,9 @@ class HazkeyServerConfig {
                         topic: currentProfile.zenzaiTopic,
                         style: currentProfile.zenzaiStyle,
                         preference: currentProfile.zenzaiPreference,
-                        leftSideContext: currentProfile.zenzaiContextualMode
-                            ? leftContext : nil
+                        leftSideContext: zenzaiLeftContext(leftContext)
                     )),
-                deviceConfig: createDeviceConfig(deviceName: deviceName)
+                deviceConfig: createDeviceConfig(deviceName: zenzaiDeviceName)
             )
         } else {
             return ConvertRequestOptions.ZenzaiMode.off
@@ -427,16 +533,37 @@ class HazkeyServerConfig {
 
         let specialCandidateProviders: [any SpecialCandidateProvider] = {
             let mode = currentProfile.specialConversionMode
-            let providers: [SpecialCandidateProvider?] = [
-                mode.commaSeparatedNumber ? CommaSeparatedNumberSpecialCandidateProvider() : nil,
-                mode.calendar ? CalendarSpecialCandidateProvider() : nil,
-                mode.hazkeyVersion ? VersionSpecialCandidateProvider() : nil,
-                mode.mailDomain ? EmailAddressSpecialCandidateProvider() : nil,
-                mode.romanTypography ? TypographySpecialCandidateProvider() : nil,
-                mode.time ? TimeExpressionSpecialCandidateProvider() : nil,
-                mode.unicodeCodepoint ? UnicodeSpecialCandidateProvider() : nil,
-            ]
-            return providers.compactMap { $0 }
+            var providers: [any SpecialCandidateProvider] = []
+            func add(
+                _ enabled: Bool, _ name: String, _ provider: any SpecialCandidateProvider,
+                mayMatch: @escaping @Sendable (String) -> Bool
+            ) {
+                guard enabled else { return }
+                providers.append(
+                    FilteredSpecialCandidateProvider(
+                        name: name, provider: provider, mayMatch: mayMatch,
+                        stats: specialProviderStats))
+            }
+            add(
+                mode.commaSeparatedNumber, "comma_separated_number",
+                CommaSeparatedNumberSpecialCandidateProvider(), mayMatch: containsDigit)
+            add(
+                mode.calendar, "calendar", CalendarSpecialCandidateProvider(),
+                mayMatch: mayBeCalendarInput)
+            add(
+                mode.hazkeyVersion, "version", VersionSpecialCandidateProvider(),
+                mayMatch: mayBeVersionInput)
+            add(
+                mode.mailDomain, "mail_domain", EmailAddressSpecialCandidateProvider(),
+                mayMatch: mayBeEmailInput)
+            add(
+                mode.romanTypography, "roman_typography", TypographySpecialCandidateProvider(),
+                mayMatch: mayBeTypographyInput)
+            add(mode.time, "time", TimeExpressionSpecialCandidateProvider(), mayMatch: containsDigit)
+            add(
+                mode.unicodeCodepoint, "unicode_codepoint", UnicodeSpecialCandidateProvider(),
+                mayMatch: mayBeUnicodeInput)
+            return providers
         }()
 
         let zenzaiMode = genZenzaiMode(leftContext: "")
@@ -565,33 +692,17 @@ class HazkeyServerConfig {
         return Array(currentProfile.submodeEntryPointChars)
     }
 
+    /// Loads the backend of the configured device and looks for the model again
     func reloadZenzaiModel() {
+        ggmlBackendDevices = ggmlBackendLoader.load(deviceName: zenzaiDeviceName)
         zenzaiModelPath = if ggmlBackendDevices.count <= 0 { nil } else { getZenzaiModelPath() }
+        zenzaiDraftModelPath = zenzaiModelPath.flatMap { getZenzaiDraftModelPath(mainModel: $0) }
         self.zenzaiAvailable = (ggmlBackendDevices.count > 0) && (zenzaiModelPath != nil)
+        zenzaiController.load(deviceName: zenzaiDeviceName)
+        zenzaiBudget.reset()
     }
 }
 
-func getZenzaiDevices() -> [GGMLBackendDevice] {
-    var ggmlBackendDirectory =
-        ProcessInfo.processInfo.environment["GGML_BACKEND_DIR"]
-        ?? (systemLibraryPath + "/libllama/backends/")
-    // trailing slash is important
-    if !ggmlBackendDirectory.hasSuffix("/") {
-        ggmlBackendDirectory.append("/")
-    }
-    loadGGMLBackends(from: ggmlBackendDirectory)
-
-    let backendDevices = enumerateGGMLBackendDevices()
-    #if DEBUG
-        for device in backendDevices {
-            NSLog(
-                "GGML Backend Device: \(device.name), Type: \(device.type), Description: \(device.description)"
-            )
-        }
-    #endif
-    return backendDevices
-}
-
 func getZenzaiModelPath() -> URL? {
     let systemZenzaiModelPath = URL(fileURLWithPath: systemResourcePath)
         .appendingPathComponent("zenzai.gguf", isDirectory: false)
@@ -615,3 +726,24 @@ func getZenzaiModelPath() -> URL? {
     }
     return nil
 }
+
+/// Small model that stands in for the main one in live conversion.
+/// It is looked up next to the main model.
+func getZenzaiDraftModelPath(mainModel: URL) -> URL? {
+    let paths: [URL] = [
+        ProcessInfo.processInfo.environment["HAZKEY_ZENZAI_DRAFT_MODEL"].map {
+            URL(filePath: $0)
+        },
+        mainModel.deletingLastPathComponent().appendingPathComponent(
+            "zenzai-draft.gguf", isDirectory: false),
+    ].compactMap { $0 }
+
+    for url in paths {
+        if let values = try? url.resourceValues(forKeys: [.isDirectoryKey]),
+            values.isDirectory == false
+        {
+            return url
+        }
+    }
+    return nil
+}
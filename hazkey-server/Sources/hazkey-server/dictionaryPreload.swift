@@ -0,0 +1,145 @@
+import Foundation
+import KanaKanjiConverterModule
+
+// The dictionary is sharded by the first character of the reading, and a
+// conversion loads the shards of the characters it looks up. Converting each
+// kana on its own loads the shards one by one, so that progress can be reported.
+private let preloadReadings: [String] =
+    (0x3041...0x3094).compactMap { Unicode.Scalar($0).map { String($0) } } + ["ー"]
+
+/// Loads the whole dictionary off the main loop.
+///
+/// The server converter loads dictionary shards lazily, which makes the
+/// first keystrokes after a start slow. A separate converter loads every
+/// shard on a background queue, while conversions keep using the lazily
+/// loading one. Once it is done, it is handed over to the server state, or
+/// to the Zenzai warmup when one is running, so that the dictionary is only
+/// loaded once.
+final class DictionaryPreload: @unchecked Sendable {
+    enum Readiness {
+        case idle
+        case loading
+        case ready
+    }
+
+    private let lock = NSLock()
+    private let queue = DispatchQueue(
+        label: "dev.hiira.hazkey.server.dictionary-preload", qos: .utility)
+    private let mapping = SharedFileMapping()
+
+    // guarded by lock
+    private var _readiness: Readiness = .idle
+    private var _loadedReadings = 0
+    private var _preloadMs: Double = 0
+    private var _firstShardMs: Double = 0
+    private var _conversionsBeforeReady: UInt64 = 0
+    private var preloadedConverter: KanaKanjiConverter?
+
+    var readiness: Readiness {
+        lock.lock()
+        defer { lock.unlock() }
+        return _readiness
+    }
+
+    func start(dictionaryURL: URL, options: ConvertRequestOptions) {
+        lock.lock()
+        guard _readiness != .loading else {
+            lock.unlock()
+            return
+        }
+        _readiness = .loading
+        _loadedReadings = 0
+        _conversionsBeforeReady = 0
+        preloadedConverter = nil
+        lock.unlock()
+
+        queue.async { [self] in
+            let start = DispatchTime.now()
+            func elapsedMs() -> Double {
+                return Double(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds)
+                    / 1_000_000
+            }
+
+            // starts reading the index files ahead of the converter, while the
+            // entry files (*.loudstxt3) are left to the lookups
+            mapping.map(dictionaryURL) { $0.pathExtension != "loudstxt3" }
+            let converter = KanaKanjiConverter.init(dictionaryURL: dictionaryURL)
+            var shardOptions = options
+            shardOptions.preloadDictionary = false
+            for (index, reading) in preloadReadings.enumerated() {
+                var composingText = ComposingText()
+                composingText.insertAtCursorPosition(reading, inputStyle: .direct)
+                let _ = converter.requestCandidates(composingText, options: shardOptions)
+                lock.lock()
+                _loadedReadings = index + 1
+                if index == 0 {
+                    _firstShardMs = elapsedMs()
+                }
+                lock.unlock()
+            }
+            // loads the shards not reached by any kana, such as symbols
+            var options = options
+            options.preloadDictionary = true
+            var composingText = ComposingText()
+            composingText.insertAtCursorPosition("あ", inputStyle: .direct)
+            let _ = converter.requestCandidates(composingText, options: options)
+
+            lock.lock()
+            defer { lock.unlock() }
+            preloadedConverter = converter
+            _readiness = .ready
+            _preloadMs = elapsedMs()
+            NSLog(
+                "Dictionary is preloaded (took \(Int(_preloadMs)) ms, \(_conversionsBeforeReady) conversions before)"
+            )
+        }
+    }
+
+    /// Counts a conversion made with the lazily loading converter.
+    func recordConversion() {
+        lock.lock()
+        defer { lock.unlock() }
+        if _readiness == .loading {
+            _conversionsBeforeReady += 1
+        }
+    }
+
+    /// Waits for a running preload and takes its converter, so that a
+    /// warmup does not load the dictionary a second time. Must not be called
+    /// from the preload queue.
+    func waitForPreloadedConverter() -> KanaKanjiConverter? {
+        queue.sync {}
+        return takePreloadedConverter()
+    }
+
+    /// Returns the preloaded converter once, after the preload has finished.
+    func takePreloadedConverter() -> KanaKanjiConverter? {
+        lock.lock()
+        defer { lock.unlock() }
+        let converter = preloadedConverter
+        preloadedConverter = nil
+        return converter
+    }
+
+    func toProto() -> Hazkey_Commands_ServerStats.DictionaryStats {
+        let mappedBytes = mapping.mappedBytes
+        let residentBytes = mapping.residentBytes
+        lock.lock()
+        defer { lock.unlock() }
+        return Hazkey_Commands_ServerStats.DictionaryStats.with {
+            $0.preloadState =
+                switch _readiness {
+                case .idle: .preloadIdle
+                case .loading: .preloadLoading
+                case .ready: .preloadReady
+                }
+            $0.loadedShards = UInt32(_loadedReadings)
+            $0.totalShards = UInt32(preloadReadings.count)
+            $0.firstShardMs = _firstShardMs
+            $0.preloadMs = _preloadMs
+            $0.conversionsBeforeReady = _conversionsBeforeReady
+            $0.mappedBytes = mappedBytes
+            $0.residentBytes = residentBytes
+        }
+    }
+}
@@ -0,0 +1,288 @@
+import Foundation
+
+private let lexiconMagic = Array("HZEL".utf8)
+private let lexiconVersion: UInt32 = 2
+private let headerSize = 16
+private let entrySize = 12
+// prefixes of more words than this have their most frequent words precomputed
+private let maxScannedEntries = 4096
+private let topWordCount = 32
+private let maxTopPrefixLength = 8
+private let topRecordSize = maxTopPrefixLength + topWordCount * 4
+private let noTopWord = Int(UInt32.max)
+
+func getEnglishLexiconPath() -> URL? {
+    if let envPath = ProcessInfo.processInfo.environment["HAZKEY_ENGLISH_LEXICON"] {
+        return URL(fileURLWithPath: envPath)
+    }
+    let systemPath = URL(fileURLWithPath: systemResourcePath).appendingPathComponent(
+        "english.lexicon")
+    return FileManager.default.fileExists(atPath: systemPath.path) ? systemPath : nil
+}
+
+/// English words with their frequencies, searched by prefix.
+///
+/// The file starts with the magic "HZEL", the format version, the word count
+/// and the number of top word records. Then come an (offset, length,
+/// frequency) entry per word, sorted by the word in ASCII lowercase, the top
+/// word records, and the UTF-8 words themselves. Every number is a little
+/// endian UInt32. The file is memory-mapped, so a lookup is a binary search
+/// over the entries without any parsing.
+///
+/// A short prefix such as "s" or "co" is the prefix of too many words to scan
+/// them all on each keystroke. Every prefix of more than 4096 words therefore
+/// has a top word record: the lowercased prefix padded with zeros to 8 bytes,
+/// followed by the indices of its 32 most frequent words that are longer than
+/// it, the most frequent first, padded with 0xFFFFFFFF. The records are sorted
+/// by their prefix.
+final class EnglishLexicon {
+    private let data: Data
+    private let count: Int
+    private let topRecordCount: Int
+    private let topRecordsOffset: Int
+    private let stringsOffset: Int
+
+    init?(url: URL) {
+        guard let data = try? Data(contentsOf: url, options: .alwaysMapped),
+            data.count >= headerSize, Array(data.prefix(4)) == lexiconMagic
+        else {
+            NSLog("Failed to load English lexicon: \(url.path)")
+            return nil
+        }
+        let (version, count, topRecordCount) = data.withUnsafeBytes {
+            (readUInt32($0, at: 4), readUInt32($0, at: 8), readUInt32($0, at: 12))
+        }
+        let topRecordsOffset = headerSize + count * entrySize
+        let stringsOffset = topRecordsOffset + topRecordCount * topRecordSize
+        guard version == Int(lexiconVersion), data.count >= stringsOffset else {
+            NSLog("Unsupported English lexicon: \(url.path)")
+            return nil
+        }
+
+        // every word and top word must lie within the file, so that lookups need no checks
+        let isValid = data.withUnsafeBytes { bytes -> Bool in
+            let stringsSize = bytes.count - stringsOffset
+            for index in 0..<count {
+                let entry = headerSize + index * entrySize
+                if readUInt32(bytes, at: entry) + readUInt32(bytes, at: entry + 4) > stringsSize {
+                    return false
+                }
+            }
+            for record in 0..<topRecordCount {
+                let indices = topRecordsOffset + record * topRecordSize + maxTopPrefixLength
+                for slot in 0..<topWordCount {
+                    let index = readUInt32(bytes, at: indices + slot * 4)
+                    if index >= count && index != noTopWord {
+                        return false
+                    }
+                }
+            }
+            return true
+        }
+        guard isValid else {
+            NSLog("Corrupt English lexicon: \(url.path)")
+            return nil
+        }
+
+        self.data = data
+        self.count = count
+        self.topRecordCount = topRecordCount
+        self.topRecordsOffset = topRecordsOffset
+        self.stringsOffset = stringsOffset
+    }
+
+    /// Returns up to `limit` words that start with `prefix` and are longer
+    /// than it, the most frequent first. The prefix is matched ignoring ASCII case.
+    func predictions(prefix: String, limit: Int) -> [String] {
+        let prefixBytes = Array(prefix.utf8).map(asciiLowercased)
+        guard !prefixBytes.isEmpty, limit > 0 else { return [] }
+
+        return data.withUnsafeBytes { bytes -> [String] in
+            func field(_ index: Int, _ offset: Int) -> Int {
+                return readUInt32(bytes, at: headerSize + index * entrySize + offset)
+            }
+            func word(_ index: Int) -> UnsafeRawBufferPointer {
+                let start = stringsOffset + field(index, 0)
+                return UnsafeRawBufferPointer(rebasing: bytes[start..<start + field(index, 4)])
+            }
+
+            if limit <= topWordCount, let record = topRecord(for: prefixBytes, in: bytes) {
+                var words: [String] = []
+                for slot in 0..<limit {
+                    let index = readUInt32(bytes, at: record + maxTopPrefixLength + slot * 4)
+                    guard index != noTopWord else { break }
+                    words.append(String(decoding: word(index), as: UTF8.self))
+                }
+                return words
+            }
+
+            // <0 when the word sorts before the prefix, 0 when it starts with it
+            func compare(_ index: Int) -> Int {
+                let word = word(index)
+                for (position, prefixByte) in prefixBytes.enumerated() {
+                    guard position < word.count else { return -1 }
+                    let wordByte = asciiLowercased(word[position])
+                    if wordByte != prefixByte {
+                        return wordByte < prefixByte ? -1 : 1
+                    }
+                }
+                return 0
+            }
+
+            var low = 0
+            var high = count
+            while low < high {
+                let middle = (low + high) / 2
+                if compare(middle) < 0 {
+                    low = middle + 1
+                } else {
+                    high = middle
+                }
+            }
+
+            // a prefix without a top word record has at most maxScannedEntries words
+            var best: [(frequency: Int, index: Int)] = []
+            var index = low
+            while index < count && index - low < maxScannedEntries && compare(index) == 0 {
+                let frequency = field(index, 8)
+                if field(index, 4) > prefixBytes.count
+                    && (best.count < limit || frequency > best[best.count - 1].frequency)
+                {
+                    let position = best.firstIndex { $0.frequency < frequency } ?? best.count
+                    best.insert((frequency, index), at: position)
+                    if best.count > limit {
+                        best.removeLast()
+                    }
+                }
+                index += 1
+            }
+            return best.map { String(decoding: word($0.index), as: UTF8.self) }
+        }
+    }
+
+    /// Offset of the top word record of the lowercased `prefix`, if it has one.
+    private func topRecord(for prefix: [UInt8], in bytes: UnsafeRawBufferPointer) -> Int? {
+        guard prefix.count <= maxTopPrefixLength else { return nil }
+        let key = topRecordKey(prefix)
+        var low = 0
+        var high = topRecordCount
+        while low < high {
+            let middle = (low + high) / 2
+            let record = topRecordsOffset + middle * topRecordSize
+            let recordKey = bytes[record..<record + maxTopPrefixLength]
+            if recordKey.elementsEqual(key) {
+                return record
+            } else if recordKey.lexicographicallyPrecedes(key) {
+                low = middle + 1
+            } else {
+                high = middle
+            }
+        }
+        return nil
+    }
+}
+
+private func readUInt32(_ bytes: UnsafeRawBufferPointer, at offset: Int) -> Int {
+    return Int(UInt32(littleEndian: bytes.loadUnaligned(fromByteOffset: offset, as: UInt32.self)))
+}
+
+private func topRecordKey(_ prefix: some Collection<UInt8>) -> [UInt8] {
+    return Array(prefix.prefix(maxTopPrefixLength))
+        + Array(repeating: 0, count: max(0, maxTopPrefixLength - prefix.count))
+}
+
+private func asciiLowercased(_ byte: UInt8) -> UInt8 {
+    return (0x41...0x5A).contains(byte) ? byte + 0x20 : byte
+}
+
+/// Entry point of --build-english-lexicon, which compiles a word list with
+/// one "word<TAB>frequency" pair per line into the lexicon format.
+func buildEnglishLexicon(arguments: [String]) -> Int32 {
+    guard let flagIndex = arguments.firstIndex(of: "--build-english-lexicon"),
+        arguments.count > flagIndex + 2
+    else {
+        print("Usage: hazkey-server --build-english-lexicon <word list> <output>")
+        return 1
+    }
+    guard let list = try? String(contentsOfFile: arguments[flagIndex + 1], encoding: .utf8)
+    else {
+        print("Error: cannot read \(arguments[flagIndex + 1])")
+        return 1
+    }
+
+    var frequencies: [String: UInt32] = [:]
+    for line in list.split(separator: "\n") {
+        let fields = line.split(whereSeparator: { $0 == "\t" || $0 == " " })
+        guard let word = fields.first, !word.hasPrefix("#") else { continue }
+        let frequency = fields.count > 1 ? UInt32(fields[1]) ?? 0 : 0
+        frequencies[String(word)] = max(frequencies[String(word)] ?? 0, frequency)
+    }
+    let words = frequencies.keys.map { Array($0.utf8) }.sorted {
+        $0.map(asciiLowercased).lexicographicallyPrecedes($1.map(asciiLowercased))
+    }
+
+    let wordFrequencies = words.map { frequencies[String(decoding: $0, as: UTF8.self)] ?? 0 }
+
+    // words sharing a prefix are adjacent, so each prefix is a run of the sorted words
+    var topRecords: [(key: [UInt8], indices: [Int])] = []
+    for length in 1...maxTopPrefixLength {
+        var start = 0
+        while start < words.count {
+            guard words[start].count >= length else {
+                start += 1
+                continue
+            }
+            let prefix = words[start].prefix(length).map(asciiLowercased)
+            var end = start + 1
+            while end < words.count,
+                words[end].count >= length,
+                words[end].prefix(length).map(asciiLowercased) == prefix
+            {
+                end += 1
+            }
+            if end - start > maxScannedEntries {
+                let top = (start..<end).filter { words[$0].count > length }
+                    .sorted {
+                        (wordFrequencies[$0], $1) > (wordFrequencies[$1], $0)
+                    }
+                    .prefix(topWordCount)
+                topRecords.append((topRecordKey(prefix), Array(top)))
+            }
+            start = end
+        }
+    }
+    topRecords.sort { $0.key.lexicographicallyPrecedes($1.key) }
+
+    var output = Data(lexiconMagic)
+    func append(_ value: UInt32) {
+        withUnsafeBytes(of: value.littleEndian) { output.append(contentsOf: $0) }
+    }
+    append(lexiconVersion)
+    append(UInt32(words.count))
+    append(UInt32(topRecords.count))
+    var offset: UInt32 = 0
+    for (word, frequency) in zip(words, wordFrequencies) {
+        append(offset)
+        append(UInt32(word.count))
+        append(frequency)
+        offset += UInt32(word.count)
+    }
+    for record in topRecords {
+        output.append(contentsOf: record.key)
+        for slot in 0..<topWordCount {
+            append(slot < record.indices.count ? UInt32(record.indices[slot]) : UInt32.max)
+        }
+    }
+    for word in words {
+        output.append(contentsOf: word)
+    }
+
+    do {
+        try output.write(to: URL(fileURLWithPath: arguments[flagIndex + 2]), options: .atomic)
+    } catch {
+        print("Error: \(error.localizedDescription)")
+        return 1
+    }
+    print("\(words.count) words")
+    return 0
+}
@@ -0,0 +1,221 @@
+import Foundation
+import KanaKanjiConverterModule
+
+struct ZenzaiBackendDevice: Codable {
+    let name: String
+    let description: String
+}
+
+private struct ZenzaiBackendDeviceCache: Codable {
+    let backendDirectoryModified: Double
+    let devices: [ZenzaiBackendDevice]
+}
+
+func getGGMLBackendDirectory() -> String {
+    var ggmlBackendDirectory =
+        ProcessInfo.processInfo.environment["GGML_BACKEND_DIR"]
+        ?? (systemLibraryPath + "/libllama/backends/")
+    // trailing slash is important
+    if !ggmlBackendDirectory.hasSuffix("/") {
+        ggmlBackendDirectory.append("/")
+    }
+    return ggmlBackendDirectory
+}
+
+/// Loads GGML backends on demand.
+///
+/// Loading the whole backend directory probes every CPU variant and
+/// initializes Vulkan, so only the backend of the configured device is loaded,
+/// together with the CPU backend that llama.cpp always needs.
+final class GGMLBackendLoader {
+    private var loadedBackends: Set<String> = []
+
+    /// Returns the devices of all backends loaded so far.
+    func load(deviceName: String) -> [GGMLBackendDevice] {
+        let wanted = Set(["cpu", backendName(of: deviceName)]).subtracting(loadedBackends)
+        if !wanted.isEmpty {
+            loadBackends(wanted, from: getGGMLBackendDirectory())
+            loadedBackends.formUnion(wanted)
+        }
+
+        let backendDevices = enumerateGGMLBackendDevices()
+        #if DEBUG
+            for device in backendDevices {
+                NSLog(
+                    "GGML Backend Device: \(device.name), Type: \(device.type), Description: \(device.description)"
+                )
+            }
+        #endif
+        return backendDevices
+    }
+
+    /// Loads every installed backend that is not loaded yet.
+    func loadAll() -> [GGMLBackendDevice] {
+        let directory = getGGMLBackendDirectory()
+        let files = (try? FileManager.default.contentsOfDirectory(atPath: directory)) ?? []
+        // libggml-<backend>.so or libggml-<backend>-<variant>.so
+        let installed = Set(
+            files.compactMap { file -> String? in
+                guard file.hasPrefix("libggml-"), file.hasSuffix(".so") else { return nil }
+                return String(file.dropFirst("libggml-".count).prefix { $0.isLetter })
+                    .lowercased()
+            }
+        ).subtracting(["base"])
+        let wanted = installed.subtracting(loadedBackends)
+        if !wanted.isEmpty {
+            loadBackends(wanted, from: directory)
+            loadedBackends.formUnion(wanted)
+        }
+        return enumerateGGMLBackendDevices()
+    }
+
+    // "CPU" -> "cpu", "Vulkan0" -> "vulkan"
+    private func backendName(of deviceName: String) -> String {
+        return String(deviceName.prefix { $0.isLetter }).lowercased()
+    }
+
+    private func loadBackends(_ names: Set<String>, from directory: String) {
+        let fileManager = FileManager.default
+        guard let files = try? fileManager.contentsOfDirectory(atPath: directory) else {
+            return
+        }
+        // loadGGMLBackends() takes a directory, so the wanted libraries are linked into a private one
+        let stagingDirectory = fileManager.temporaryDirectory.appendingPathComponent(
+            "hazkey-ggml-backends-\(getpid())", isDirectory: true)
+        try? fileManager.removeItem(at: stagingDirectory)
+        do {
+            try fileManager.createDirectory(
+                at: stagingDirectory, withIntermediateDirectories: true)
+            defer { try? fileManager.removeItem(at: stagingDirectory) }
+            for file in files
+            where names.contains(where: {
+                file.hasPrefix("libggml-\($0).") || file.hasPrefix("libggml-\($0)-")
+            }) {
+                try fileManager.createSymbolicLink(
+                    atPath: stagingDirectory.appendingPathComponent(file).path,
+                    withDestinationPath: directory + file)
+            }
+            loadGGMLBackends(from: stagingDirectory.path + "/")
+        } catch {
+            NSLog("Failed to select GGML backends, loading all of them: \(error)")
+            loadGGMLBackends(from: directory)
+        }
+    }
+}
+
+/// Devices of every installed backend, listed without loading them into
+/// this process.
+///
+/// Listing them starts a child process that loads every backend, which takes
+/// seconds when Vulkan initializes. It runs on a background queue at startup
+/// and again once the backend directory changes. Callers get the last list,
+/// which is empty until the first one is done. The list is kept in the cache
+/// directory, so a restart reuses it without a child process.
+final class ZenzaiBackendDeviceList: @unchecked Sendable {
+    private let lock = NSLock()
+    private let queue = DispatchQueue(
+        label: "dev.hiira.hazkey.server.backend-devices", qos: .utility)
+    private let cacheURL = HazkeyServerConfig.getCacheDirectory().appendingPathComponent(
+        "ggml_devices.json")
+
+    // guarded by lock
+    private var _devices: [ZenzaiBackendDevice] = []
+    // modification time of the backend directory the list was made for
+    private var listedModified: Double?
+    private var isListing = false
+
+    /// The last listed devices. A new list is started when the backend
+    /// directory has changed since.
+    var devices: [ZenzaiBackendDevice] {
+        refresh()
+        lock.lock()
+        defer { lock.unlock() }
+        return _devices
+    }
+
+    /// Lists the devices in the background, unless the list is up to date.
+    func refresh() {
+        let directory = getGGMLBackendDirectory()
+        let modificationDate =
+            (try? FileManager.default.attributesOfItem(atPath: directory))?[.modificationDate]
+            as? Date
+        let modified = modificationDate?.timeIntervalSince1970 ?? 0
+
+        lock.lock()
+        guard !isListing, listedModified != modified else {
+            lock.unlock()
+            return
+        }
+        isListing = true
+        lock.unlock()
+
+        queue.async { [self] in
+            let devices = loadCache(modified: modified) ?? listDevices(modified: modified)
+            lock.lock()
+            if let devices = devices {
+                _devices = devices
+            }
+            // a failed listing is retried once the directory changes
+            listedModified = modified
+            isListing = false
+            lock.unlock()
+        }
+    }
+
+    private func loadCache(modified: Double) -> [ZenzaiBackendDevice]? {
+        guard let data = try? Data(contentsOf: cacheURL),
+            let cache = try? JSONDecoder().decode(ZenzaiBackendDeviceCache.self, from: data),
+            cache.backendDirectoryModified == modified
+        else {
+            return nil
+        }
+        return cache.devices
+    }
+
+    private func listDevices(modified: Double) -> [ZenzaiBackendDevice]? {
+        let process = Process()
+        process.executableURL = URL(fileURLWithPath: "/proc/self/exe")
+        process.arguments = ["--list-ggml-devices"]
+        let output = Pipe()
+        process.standardOutput = output
+        do {
+            try process.run()
+        } catch {
+            NSLog("Failed to enumerate GGML backend devices: \(error)")
+            return nil
+        }
+        let data = output.fileHandleForReading.readDataToEndOfFile()
+        process.waitUntilExit()
+        guard process.terminationStatus == 0,
+            let devices = try? JSONDecoder().decode([ZenzaiBackendDevice].self, from: data)
+        else {
+            NSLog(
+                "Failed to enumerate GGML backend devices: exit status \(process.terminationStatus)"
+            )
+            return nil
+        }
+
+        do {
+            try FileManager.default.createDirectory(
+                at: cacheURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+            let cache = ZenzaiBackendDeviceCache(
+                backendDirectoryModified: modified, devices: devices)
+            try JSONEncoder().encode(cache).write(to: cacheURL, options: .atomic)
+        } catch {
+            NSLog("Failed to save GGML backend device cache: \(error.localizedDescription)")
+        }
+        return devices
+    }
+}
+
+/// Entry point of --list-ggml-devices, which prints every backend device as JSON.
+func printZenzaiBackendDevices() -> Int32 {
+    let devices = GGMLBackendLoader().loadAll().map {
+        ZenzaiBackendDevice(name: $0.name, description: $0.description)
+    }
+    guard let data = try? JSONEncoder().encode(devices) else {
+        return 1
+    }
+    FileHandle.standardOutput.write(data)
+    return 0
+}
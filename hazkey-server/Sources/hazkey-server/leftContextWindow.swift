@@ -0,0 +1,102 @@
+import Foundation
+
+let ZENZAI_LEFT_CONTEXT_TOKEN_LIMIT = 128
+
+/// Left context for Zenzai, limited to the last `tokenLimit` tokens.
+///
+/// Tokens are estimated like the Zenzai vocabulary splits text: one per
+/// kana, kanji or symbol, and one per up to four ASCII letters or digits.
+/// Text appended after the previous context is tokenized on its own, and
+/// any other change only tokenizes as much of the tail as the limit can hold.
+///
+/// The context comes before the reading in the Zenzai prompt, so dropping
+/// its first token changes every token after it and none of the KV cache of
+/// the previous prompt can be reused. Once over the limit, the window is
+/// therefore cut down to three quarters of it, and the next quarter of
+/// typing only appends to an unchanged start.
+struct LeftContextWindow {
+    let tokenLimit: Int
+    /// The kept context
+    private(set) var text = ""
+    // context passed to the last update()
+    private var source = ""
+    // length of every token of text, in characters
+    private var tokenLengths: [Int] = []
+
+    private static let maxTokenLength = 4
+
+    // tokens kept when the window is cut
+    private var trimmedLimit: Int {
+        return tokenLimit - tokenLimit / 4
+    }
+
+    init(tokenLimit: Int) {
+        self.tokenLimit = tokenLimit
+    }
+
+    /// Returns false when the kept context did not change.
+    mutating func update(_ leftContext: String) -> Bool {
+        guard leftContext != source else { return false }
+        let oldText = text
+
+        // typed or committed text. The client cuts the start of a long context,
+        // so a full window is also kept when it is still followed by only new text
+        var appended: Substring?
+        if !source.isEmpty, leftContext.hasPrefix(source) {
+            appended = leftContext.dropFirst(source.count)
+        } else if tokenLengths.count >= trimmedLimit,
+            let range = leftContext.range(of: text, options: .backwards)
+        {
+            appended = leftContext[range.upperBound...]
+        }
+
+        if let appended = appended, !tokenLengths.isEmpty {
+            // the last token may grow, so it is redone
+            let lastLength = tokenLengths.removeLast()
+            let tail = String(text.suffix(lastLength)) + appended
+            text = String(text.dropLast(lastLength))
+            tokenLengths += Self.tokenize(tail[...])
+            text += tail
+        } else {
+            let tail = leftContext.suffix(tokenLimit * Self.maxTokenLength)
+            tokenLengths = Self.tokenize(tail)
+            text = String(tail)
+        }
+        source = leftContext
+
+        if tokenLengths.count > tokenLimit {
+            let dropped = tokenLengths.count - trimmedLimit
+            text = String(text.dropFirst(tokenLengths.prefix(dropped).reduce(0, +)))
+            tokenLengths.removeFirst(dropped)
+        }
+        return text != oldText
+    }
+
+    mutating func reset() {
+        text = ""
+        source = ""
+        tokenLengths = []
+    }
+
+    private static func tokenize(_ text: Substring) -> [Int] {
+        var lengths: [Int] = []
+        var asciiRun = 0
+        func flushAsciiRun() {
+            while asciiRun > 0 {
+                let length = min(asciiRun, maxTokenLength)
+                lengths.append(length)
+                asciiRun -= length
+            }
+        }
+        for character in text {
+            if character.isASCII && (character.isLetter || character.isNumber) {
+                asciiRun += 1
+            } else {
+                flushAsciiRun()
+                lengths.append(1)
+            }
+        }
+        flushAsciiRun()
+        return lengths
+    }
+}
@@ -1,5 +1,21 @@
 import Foundation
 
+if CommandLine.arguments.contains("--list-ggml-devices") {
+    exit(printZenzaiBackendDevices())
+}
+
+if CommandLine.arguments.contains("--bench-zenzai") {
+    exit(printZenzaiBenchmark(serialized: CommandLine.arguments.contains("--serialized")))
+}
+
+if CommandLine.arguments.contains("--build-english-lexicon") {
+    exit(buildEnglishLexicon(arguments: CommandLine.arguments))
+}
+
+if CommandLine.arguments.contains("--zenzai-worker") {
+    exit(runZenzaiWorker(arguments: CommandLine.arguments))
+}
+
 do {
     NSLog("Starting hazkey-server...")
     let server = HazkeyServer()
@@ -0,0 +1,64 @@
+import Foundation
+import KanaKanjiConverterModule
+
+/// Prediction candidates of the last reading that was looked up in full.
+///
+/// The predictions of a reading are words whose reading starts with it, so
+/// those of a longer reading are among them. While the user keeps typing,
+/// the predictions are filtered from the kept set instead of being looked
+/// up again. That only holds when the lookup returned all of its
+/// predictions: a list cut at the number shown may have left out words of
+/// the longer reading. A full lookup is also made when fewer predictions
+/// are left than were shown, and while the reading ends in romaji that is
+/// not converted yet, which no kana reading starts with.
+struct PredictionCache {
+    private var reading = ""
+    private var entries: [(candidate: Candidate, ruby: String)] = []
+    // the lookup returned fewer predictions than it was asked for
+    private var isComplete = false
+    // predictions the full lookup gave, up to the number shown
+    private var shownCount = 0
+
+    mutating func store(reading: String, candidates: [Candidate], shownCount: Int) {
+        // the kept kana reading is still extended once the romaji is converted
+        guard !Self.endsInRomaji(reading) else { return }
+        self.reading = reading
+        entries = candidates.map { candidate in
+            (candidate, TextWidthTables.hiragana(candidate.data.map { $0.ruby }.joined()))
+        }
+        isComplete = candidates.count < shownCount
+        self.shownCount = min(candidates.count, shownCount)
+    }
+
+    /// Returns the predictions for `reading`, which consume `inputCount`
+    /// input elements, or nil when they need a full lookup.
+    func candidates(for reading: String, inputCount: Int) -> [Candidate]? {
+        guard !self.reading.isEmpty, reading.hasPrefix(self.reading), !Self.endsInRomaji(reading)
+        else { return nil }
+        let matching: [(candidate: Candidate, ruby: String)]
+        if reading == self.reading {
+            // the same reading may come from other input, such as "n" and "nn"
+            matching = entries
+        } else {
+            guard isComplete else { return nil }
+            matching = entries.filter { $0.ruby.hasPrefix(reading) }
+            guard !matching.isEmpty, matching.count >= shownCount else { return nil }
+        }
+        return matching.map { entry in
+            var candidate = entry.candidate
+            candidate.composingCount = .inputCount(inputCount)
+            return candidate
+        }
+    }
+
+    mutating func reset() {
+        reading = ""
+        entries = []
+        isComplete = false
+        shownCount = 0
+    }
+
+    private static func endsInRomaji(_ reading: String) -> Bool {
+        return reading.last.map { $0.isASCII && $0.isLetter } ?? false
+    }
+}
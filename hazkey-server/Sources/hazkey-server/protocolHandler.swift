@@ -41,6 +41,10 @@ class ProtocolHandler {
             response = state.completePrefix(candidateIndex: Int(req.index))
         case .moveCursor(let req):
             response = state.moveCursor(offset: Int(req.offset))
+        case .resizeClause(let req):
+            response = state.resizeClause(offset: Int(req.offset))
+        case .reconvert(let req):
+            response = state.reconvert(text: req.text)
         case .getHiraganaWithCursor:
             response = state.getHiraganaWithCursor()
         case .getComposingString(let req):
@@ -52,6 +56,8 @@ class ProtocolHandler {
             response = state.getCurrentInputMode()
         case .saveLearningData:
             response = state.saveLearningData()
+        case .getServerStats:
+            response = state.getServerStats()
         case .getConfig:
             response = state.serverConfig.getCurrentConfig()
         case .setConfig(let req):
@@ -60,10 +66,9 @@ class ProtocolHandler {
         case .clearAllHistory_p:
             response = state.clearProfileLearningData()
         case .reloadZenzaiModel:
-            state.serverConfig.reloadZenzaiModel()
-            response = Hazkey_ResponseEnvelope.with {
-                $0.status = .success
-            }
+            response = state.reloadZenzaiModel()
+        case .benchmarkZenzai(let req):
+            response = state.benchmarkZenzai(start: req.start, applyFastest: req.applyFastest)
         case .getDefaultProfile:
             NSLog("Unimplemented: getDefaultProfile")
             response = Hazkey_ResponseEnvelope.with {
@@ -0,0 +1,78 @@
+import Foundation
+
+// Committed clauses remembered for reconversion
+let RECONVERSION_INDEX_CAPACITY = 1024
+// longer selections are not looked up
+private let reconversionMaxSelectionLength = 64
+
+/// Readings of recently committed clauses, looked up by their text.
+///
+/// Committed text that was not typed in this session has no reading here,
+/// and finding one would take a reverse lookup over the whole dictionary.
+/// Recent commits cover what is usually reconverted: text the user just
+/// wrote and picked the wrong candidate for.
+struct ReconversionIndex {
+    private var readings: [String: String] = [:]
+    // committed texts, the least recently committed first
+    private var order: [String] = []
+
+    mutating func record(text: String, reading: String) {
+        guard !text.isEmpty, !reading.isEmpty else { return }
+        if readings.updateValue(reading, forKey: text) != nil {
+            order.removeAll { $0 == text }
+        }
+        order.append(text)
+        if order.count > RECONVERSION_INDEX_CAPACITY {
+            readings.removeValue(forKey: order.removeFirst())
+        }
+    }
+
+    /// Returns the reading of `text`, which may span several committed
+    /// clauses. Kana outside of any clause reads as itself.
+    func reading(for text: String) -> String? {
+        guard !text.isEmpty, text.count <= reconversionMaxSelectionLength else { return nil }
+        if let reading = readings[text] {
+            return reading
+        }
+
+        // the longest committed clause at each position, left to right
+        let characters = Array(text)
+        var reading = ""
+        var start = 0
+        while start < characters.count {
+            var end = characters.count
+            while end > start, readings[String(characters[start..<end])] == nil {
+                end -= 1
+            }
+            if end > start {
+                reading += readings[String(characters[start..<end])]!
+                start = end
+            } else if let kana = hiragana(of: characters[start]) {
+                reading.append(kana)
+                start += 1
+            } else {
+                return nil
+            }
+        }
+        return reading
+    }
+
+    mutating func removeAll() {
+        readings.removeAll()
+        order.removeAll()
+    }
+
+    private func hiragana(of character: Character) -> Character? {
+        guard character.unicodeScalars.count == 1,
+            let scalar = character.unicodeScalars.first
+        else { return nil }
+        switch scalar.value {
+        case 0x3041...0x3096, 0x30FC:
+            return character
+        case 0x30A1...0x30F6:
+            return Unicode.Scalar(scalar.value - 0x60).map { Character($0) }
+        default:
+            return nil
+        }
+    }
+}
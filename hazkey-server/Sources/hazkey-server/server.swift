@@ -75,4 +75,8 @@ class HazkeyServer: SocketManagerDelegate {
     func socketManager(_ manager: SocketManager, clientDidConnect clientFd: Int32) {}
 
     func socketManager(_ manager: SocketManager, clientDidDisconnect clientFd: Int32) {}
+
+    func socketManagerDidTimeout(_ manager: SocketManager) {
+        state?.unloadZenzaiIfIdle()
+    }
 }
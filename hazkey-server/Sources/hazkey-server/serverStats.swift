@@ -0,0 +1,55 @@
+import Foundation
+
+/// Runtime counters reported by the GetServerStats command
+final class HazkeyServerStats {
+    private var zenzaiConversions: UInt64 = 0
+    private var zenzaiEstimatedPromptBytes: UInt64 = 0
+    private var zenzaiEstimatedSharedBytes: UInt64 = 0
+    private var lastZenzaiPrompt: [UInt8] = []
+    private var zenzaiIdleUnloads: UInt32 = 0
+    private var unloadRssBeforeBytes: UInt64 = 0
+    private var unloadRssAfterBytes: UInt64 = 0
+
+    /// Records how much of a Zenzai prompt is shared with the previous one.
+    ///
+    /// Zenzai keeps the KV cache of the previous evaluation, so only the part
+    /// after the common prefix has to be evaluated again. The converter builds
+    /// the prompt and does not report the tokens it reuses, so `prompt` is an
+    /// approximation made of the same inputs, in bytes rather than tokens. It
+    /// leaves out the template text around them and the candidates being
+    /// verified, so the ratio is only an estimate of the real reuse.
+    func recordZenzaiPrompt(_ prompt: String) {
+        let bytes = Array(prompt.utf8)
+        let sharedBytes = zip(bytes, lastZenzaiPrompt).prefix { $0 == $1 }.count
+        zenzaiConversions += 1
+        zenzaiEstimatedPromptBytes += UInt64(bytes.count)
+        zenzaiEstimatedSharedBytes += UInt64(sharedBytes)
+        lastZenzaiPrompt = bytes
+    }
+
+    /// Records the resident set size around the last idle unload of the Zenzai model.
+    func recordZenzaiUnload(rssBeforeBytes: UInt64, rssAfterBytes: UInt64) {
+        zenzaiIdleUnloads += 1
+        unloadRssBeforeBytes = rssBeforeBytes
+        unloadRssAfterBytes = rssAfterBytes
+    }
+
+    func toProto(scoreCache: ZenzaiScoreCache) -> Hazkey_Commands_ServerStats {
+        return Hazkey_Commands_ServerStats.with {
+            $0.zenzai = Hazkey_Commands_ServerStats.ZenzaiStats.with {
+                $0.conversions = zenzaiConversions
+                $0.estimatedPromptBytes = zenzaiEstimatedPromptBytes
+                $0.estimatedSharedPrefixBytes = zenzaiEstimatedSharedBytes
+                $0.estimatedSharedPrefixRatio =
+                    zenzaiEstimatedPromptBytes > 0
+                    ? Double(zenzaiEstimatedSharedBytes) / Double(zenzaiEstimatedPromptBytes) : 0
+                $0.scoreCacheHits = scoreCache.hits
+                $0.scoreCacheMisses = scoreCache.misses
+                $0.rssBytes = currentResidentBytes()
+                $0.idleUnloads = zenzaiIdleUnloads
+                $0.unloadRssBeforeBytes = unloadRssBeforeBytes
+                $0.unloadRssAfterBytes = unloadRssAfterBytes
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+import Foundation
+
+/// Read-only mappings of the dictionary files, for read-ahead and residency.
+///
+/// The converter reads these files with its own I/O and never sees the
+/// mappings, and nothing is locked in memory, so the kernel may evict the
+/// pages at any time. The mappings are a prefetch hint: files chosen by
+/// `prefetch` are read ahead with MADV_WILLNEED, so that the converter finds
+/// them in the page cache. They also let residentBytes count the pages of
+/// the files that are in the page cache.
+final class SharedFileMapping: @unchecked Sendable {
+    private struct Mapping {
+        let address: UnsafeMutableRawPointer
+        let length: Int
+    }
+
+    private let lock = NSLock()
+    // guarded by lock
+    private var mappings: [Mapping] = []
+    private var mappedURL: URL?
+
+    deinit {
+        unmap()
+    }
+
+    /// Maps the file, or every file under the directory, unless it is mapped already.
+    func map(_ url: URL, prefetch: (URL) -> Bool) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard mappedURL != url else { return }
+        unmapLocked()
+        mappedURL = url
+
+        var fileURLs = [url]
+        if (try? url.resourceValues(forKeys: [.isDirectoryKey]))?.isDirectory == true {
+            let enumerator = FileManager.default.enumerator(
+                at: url, includingPropertiesForKeys: [.isRegularFileKey])
+            fileURLs = (enumerator?.allObjects as? [URL] ?? []).filter {
+                (try? $0.resourceValues(forKeys: [.isRegularFileKey]))?.isRegularFile == true
+            }
+        }
+        for fileURL in fileURLs {
+            let fd = open(fileURL.path, O_RDONLY | O_CLOEXEC)
+            guard fd >= 0 else { continue }
+            defer { close(fd) }
+            var fileStat = stat()
+            guard fstat(fd, &fileStat) == 0, fileStat.st_size > 0 else { continue }
+            let length = Int(fileStat.st_size)
+            guard let address = mmap(nil, length, PROT_READ, MAP_SHARED, fd, 0),
+                address != UnsafeMutableRawPointer(bitPattern: -1)
+            else {
+                NSLog("Failed to map \(fileURL.path): \(String(cString: strerror(errno)))")
+                continue
+            }
+            if prefetch(fileURL) {
+                madvise(address, length, MADV_WILLNEED)
+            }
+            mappings.append(Mapping(address: address, length: length))
+        }
+    }
+
+    func unmap() {
+        lock.lock()
+        defer { lock.unlock() }
+        unmapLocked()
+    }
+
+    /// Bytes mapped by this process.
+    var mappedBytes: UInt64 {
+        lock.lock()
+        defer { lock.unlock() }
+        return mappings.reduce(0) { $0 + UInt64($1.length) }
+    }
+
+    /// Mapped bytes that are currently in the page cache.
+    var residentBytes: UInt64 {
+        lock.lock()
+        defer { lock.unlock() }
+        let pageSize = Int(sysconf(Int32(_SC_PAGESIZE)))
+        var residentPages: UInt64 = 0
+        for mapping in mappings {
+            var vector = [UInt8](repeating: 0, count: (mapping.length + pageSize - 1) / pageSize)
+            guard mincore(mapping.address, mapping.length, &vector) == 0 else { continue }
+            residentPages += UInt64(vector.lazy.filter { $0 & 1 != 0 }.count)
+        }
+        return residentPages * UInt64(pageSize)
+    }
+
+    private func unmapLocked() {
+        for mapping in mappings {
+            munmap(mapping.address, mapping.length)
+        }
+        mappings = []
+        mappedURL = nil
+    }
+}
@@ -5,6 +5,8 @@ protocol SocketManagerDelegate: AnyObject {
         -> Data
     func socketManager(_ manager: SocketManager, clientDidConnect clientFd: Int32)
     func socketManager(_ manager: SocketManager, clientDidDisconnect clientFd: Int32)
+    // called about once a second while no request arrives
+    func socketManagerDidTimeout(_ manager: SocketManager)
 }
 
 class SocketManager {
@@ -130,6 +132,7 @@ class SocketManager {
 
             if pollRes == 0 {
                 // Timeout
+                delegate?.socketManagerDidTimeout(self)
                 continue
             }
 
@@ -0,0 +1,111 @@
+import Foundation
+import KanaKanjiConverterModule
+
+/// Call counts and timings of the special candidate providers
+final class SpecialCandidateProviderStats: @unchecked Sendable {
+    private struct Counters {
+        var calls: UInt64 = 0
+        var skips: UInt64 = 0
+        var totalNs: UInt64 = 0
+        var maxNs: UInt64 = 0
+    }
+
+    private let lock = NSLock()
+    // guarded by lock, in the order the providers were first seen
+    private var names: [String] = []
+    private var counters: [String: Counters] = [:]
+
+    func recordSkip(_ name: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        update(name) { $0.skips += 1 }
+    }
+
+    func recordCall(_ name: String, elapsedNs: UInt64) {
+        lock.lock()
+        defer { lock.unlock() }
+        update(name) {
+            $0.calls += 1
+            $0.totalNs += elapsedNs
+            $0.maxNs = max($0.maxNs, elapsedNs)
+        }
+    }
+
+    func toProto() -> [Hazkey_Commands_ServerStats.SpecialProviderStats] {
+        lock.lock()
+        defer { lock.unlock() }
+        return names.map { name in
+            let counter = counters[name] ?? Counters()
+            return Hazkey_Commands_ServerStats.SpecialProviderStats.with {
+                $0.name = name
+                $0.calls = counter.calls
+                $0.skips = counter.skips
+                $0.totalMs = Double(counter.totalNs) / 1_000_000
+                $0.maxMs = Double(counter.maxNs) / 1_000_000
+            }
+        }
+    }
+
+    private func update(_ name: String, _ body: (inout Counters) -> Void) {
+        if counters[name] == nil {
+            names.append(name)
+            counters[name] = Counters()
+        }
+        body(&counters[name]!)
+    }
+}
+
+/// Runs a special candidate provider only for input it can possibly match.
+///
+/// The converter calls every provider on every conversion, while each of
+/// them only handles a particular shape of input. `mayMatch` is a cheap test
+/// of the input that must never reject what the provider would convert.
+struct FilteredSpecialCandidateProvider: SpecialCandidateProvider {
+    let name: String
+    let provider: any SpecialCandidateProvider
+    let mayMatch: @Sendable (String) -> Bool
+    let stats: SpecialCandidateProviderStats
+
+    func provideCandidates(converter: KanaKanjiConverter, inputData: ComposingText) -> [Candidate] {
+        guard mayMatch(inputData.convertTarget) else {
+            stats.recordSkip(name)
+            return []
+        }
+        let start = DispatchTime.now()
+        let candidates = provider.provideCandidates(converter: converter, inputData: inputData)
+        stats.recordCall(
+            name, elapsedNs: DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds)
+        return candidates
+    }
+}
+
+// Input tests of the providers. Numbers may be typed in full width, and
+// 元年 has no digit at all.
+
+@Sendable func containsDigit(_ text: String) -> Bool {
+    return text.unicodeScalars.contains {
+        ("0"..."9").contains($0) || ("０"..."９").contains($0)
+    }
+}
+
+@Sendable func mayBeCalendarInput(_ text: String) -> Bool {
+    return containsDigit(text) || text.contains("ねん")
+}
+
+@Sendable func mayBeEmailInput(_ text: String) -> Bool {
+    return text.contains("@") || text.contains("＠")
+}
+
+@Sendable func mayBeVersionInput(_ text: String) -> Bool {
+    return text.contains("ばーじょん") || text.contains("バージョン")
+}
+
+@Sendable func mayBeTypographyInput(_ text: String) -> Bool {
+    return text.unicodeScalars.contains { $0.isASCII && $0.properties.isAlphabetic }
+        || containsDigit(text)
+}
+
+@Sendable func mayBeUnicodeInput(_ text: String) -> Bool {
+    return text.hasPrefix("U+") || text.hasPrefix("u+") || text.hasPrefix("Ｕ＋")
+        || text.hasPrefix("ｕ＋")
+}
@@ -4,7 +4,9 @@ import SwiftUtils
 
 class HazkeyServerState {
     let serverConfig: HazkeyServerConfig
-    let converter: KanaKanjiConverter
+    var converter: KanaKanjiConverter
+    // has the draft model loaded, for live conversion
+    var draftConverter: KanaKanjiConverter?
     var currentCandidateList: [Candidate]?
     var composingText: ComposingTextBox = ComposingTextBox()
 
@@ -12,7 +14,35 @@ class HazkeyServerState {
     var isSubInputMode = false
     var learningDataNeedsCommit = false
 
+    var leftContext: String = ""
+    // length of the first clause set by resizeClause(), for the reading it was set on
+    private var resizedClause: (reading: String, length: Int)?
+    private var reconversionIndex = ReconversionIndex()
+    private var predictionCache = PredictionCache()
+    private var leftContextWindow = LeftContextWindow(tokenLimit: ZENZAI_LEFT_CONTEXT_TOKEN_LIMIT)
+    let stats = HazkeyServerStats()
+    let dictionaryPreload = DictionaryPreload()
+    let zenzaiWarmup = ZenzaiWarmup()
+    let zenzaiDraftWarmup = ZenzaiWarmup()
+    let zenzaiWorker = ZenzaiWorkerClient()
+    let zenzaiBenchmark = ZenzaiBenchmark()
+    let zenzaiScoreCache = ZenzaiScoreCache(
+        storeURL: HazkeyServerConfig.getCacheDirectory().appendingPathComponent(
+            "zenzai_score_cache.json"))
+    private var applyZenzaiBenchmark = false
+    private var zenzaiWarmupKey: String?
+    private var zenzaiDraftWarmupKey: String?
+    private var lastZenzaiUse = DispatchTime.now()
+    private var isZenzaiUnloaded = false
+    // the converter was handed over by zenzaiWarmup and holds the model
+    private var hasWarmZenzaiConverter = false
+    // loaded on the first English prediction, nil when there is no lexicon
+    private var englishLexicon: EnglishLexicon?
+    private var isEnglishLexiconLoaded = false
+
     var keymap: Keymap
+    var compiledKeymap: CompiledKeymap
+    var typoCorrector: TypoCorrector
     var currentTableName: String
     var baseConvertRequestOptions: ConvertRequestOptions
 
@@ -23,8 +53,10 @@ class HazkeyServerState {
 
         // Initialize keymap and table
         self.keymap = serverConfig.loadKeymap()
+        self.typoCorrector = TypoCorrector(keymap: keymap)
         self.currentTableName = UUID().uuidString
         serverConfig.loadInputTable(tableName: currentTableName)
+        self.compiledKeymap = CompiledKeymap(keymap: keymap, tableName: currentTableName)
 
         // Create user state directories (history data)
         do {
@@ -59,12 +91,22 @@ class HazkeyServerState {
 
         // Initialize base convert options
         self.baseConvertRequestOptions = serverConfig.genBaseConvertRequestOptions()
+
+        configureZenzaiScoreCache()
+        // listed for the settings in the background, as it starts a child process
+        serverConfig.zenzaiBackendDeviceList.refresh()
+        // the Zenzai warmup takes over the preloaded converter, so the preload goes first
+        startDictionaryPreload()
+        startZenzaiWarmup()
     }
 
     func setContext(surroundingText: String, anchorIndex: Int) -> Hazkey_ResponseEnvelope {
-        let leftContext = String(surroundingText.prefix(anchorIndex))
-        baseConvertRequestOptions.zenzaiMode = serverConfig.genZenzaiMode(
-            leftContext: leftContext)
+        // keep the Zenzai prompt as is so that its KV cache prefix stays valid
+        if leftContextWindow.update(String(surroundingText.prefix(anchorIndex))) {
+            leftContext = leftContextWindow.text
+            baseConvertRequestOptions.zenzaiMode = serverConfig.genZenzaiMode(
+                leftContext: leftContext)
+        }
 
         return Hazkey_ResponseEnvelope.with {
             $0.status = .success
@@ -76,6 +118,8 @@ class HazkeyServerState {
     func createComposingTextInstanse() -> Hazkey_ResponseEnvelope {
         composingText = ComposingTextBox()
         currentCandidateList = nil
+        resizedClause = nil
+        predictionCache.reset()
         isSubInputMode = false
         isShiftPressedAlone = false
         return Hazkey_ResponseEnvelope.with {
@@ -84,6 +128,7 @@ class HazkeyServerState {
     }
 
     func inputChar(inputString: String) -> Hazkey_ResponseEnvelope {
+        touchZenzai()
         guard let inputChar = inputString.first else {
             return Hazkey_ResponseEnvelope.with {
                 $0.status = .failed
@@ -98,23 +143,15 @@ class HazkeyServerState {
         if isSubInputMode {
             composingText.value.insertAtCursorPosition(String(inputChar), inputStyle: .direct)
         } else {
-            let piece: InputPiece
-            if let (intentionChar, overrideInputChar) = keymap[inputChar] {
-                piece = .key(
-                    intention: intentionChar, input: overrideInputChar ?? inputChar, modifiers: [])
-            } else {
-                piece = .character(inputChar)
-            }
-
-            composingText.value.insertAtCursorPosition([
-                ComposingText.InputElement(
-                    piece: piece,
-                    inputStyle: .mapped(id: .tableName(currentTableName)))
-            ])
+            composingText.value.insertAtCursorPosition([tableInputElement(inputChar)])
         }
         return Hazkey_ResponseEnvelope.with { $0.status = .success }
     }
 
+    private func tableInputElement(_ inputChar: Character) -> ComposingText.InputElement {
+        return compiledKeymap.inputElement(for: inputChar)
+    }
+
     func processModifierEvent(
         modifier: Hazkey_Commands_ModifierEvent.ModifierType,
         event: Hazkey_Commands_ModifierEvent.EventType
@@ -160,6 +197,9 @@ class HazkeyServerState {
             converter.commitUpdateLearningData()
             learningDataNeedsCommit = false
         }
+        if serverConfig.currentProfile.zenzaiPersistScoreCache {
+            zenzaiScoreCache.save()
+        }
         return Hazkey_ResponseEnvelope.with {
             $0.status = .success
         }
@@ -181,9 +221,19 @@ class HazkeyServerState {
 
     func completePrefix(candidateIndex: Int) -> Hazkey_ResponseEnvelope {
         if let completedCandidate = currentCandidateList?[candidateIndex] {
+            // the candidate's own reading, which may differ from the typed one after
+            // a typo correction
+            reconversionIndex.record(
+                text: completedCandidate.text,
+                reading: TextWidthTables.hiragana(
+                    completedCandidate.data.map { $0.ruby }.joined()))
             composingText.value.prefixComplete(composingCount: completedCandidate.composingCount)
             converter.setCompletedData(completedCandidate)
             converter.updateLearningData(completedCandidate)
+            // the learned candidate may rank differently now
+            predictionCache.reset()
+            draftConverter?.setCompletedData(completedCandidate)
+            draftConverter?.updateLearningData(completedCandidate)
             learningDataNeedsCommit = true
         } else {
             return Hazkey_ResponseEnvelope.with {
@@ -203,28 +253,59 @@ class HazkeyServerState {
         }
     }
 
-    /// ComposingText -> Characters
+    /// Starts over with the reading of committed `text` as the composing text.
+    /// The response text is the reading, or empty when it is not known.
+    func reconvert(text: String) -> Hazkey_ResponseEnvelope {
+        guard let reading = reconversionIndex.reading(for: text) else {
+            return Hazkey_ResponseEnvelope.with {
+                $0.status = .success
+                $0.text = ""
+            }
+        }
+        let _ = createComposingTextInstanse()
+        composingText.value.insertAtCursorPosition(reading, inputStyle: .direct)
+        return Hazkey_ResponseEnvelope.with {
+            $0.status = .success
+            $0.text = reading
+        }
+    }
 
-    func getHiraganaWithCursor() -> Hazkey_ResponseEnvelope {
-        func safeSubstring(_ text: String, start: Int, end: Int) -> String {
-            guard start >= 0, end >= 0, start < text.count, end <= text.count, start < end else {
-                return ""
+    /// Shrinks or extends the first clause of the conversion by `offset` characters.
+    /// The next complete conversion only lists candidates of that length.
+    func resizeClause(offset: Int) -> Hazkey_ResponseEnvelope {
+        let reading = completeReading().hiragana
+        guard !reading.isEmpty else {
+            return Hazkey_ResponseEnvelope.with {
+                $0.status = .failed
+                $0.errorMessage = "No text to convert"
             }
+        }
+        let currentLength =
+            clauseLength(for: reading) ?? currentCandidateList?.first?.rubyCount ?? reading.count
+        resizedClause = (reading, min(max(currentLength + offset, 1), reading.count))
+        // Shift was held for the resize, so its release must not toggle the input mode
+        isShiftPressedAlone = false
+        return Hazkey_ResponseEnvelope.with {
+            $0.status = .success
+        }
+    }
 
-            let startIndex = text.index(text.startIndex, offsetBy: start)
-            let endIndex = text.index(text.startIndex, offsetBy: end)
+    private func clauseLength(for reading: String) -> Int? {
+        guard let clause = resizedClause, clause.reading == reading else { return nil }
+        return clause.length
+    }
 
-            return String(text[startIndex..<endIndex])
-        }
+    /// ComposingText -> Characters
 
-        let hiragana = composingText.value.toHiragana()
+    func getHiraganaWithCursor() -> Hazkey_ResponseEnvelope {
+        let hiraganaCount = composingText.hiraganaCount
         let cursorPos = composingText.value.convertTargetCursorPosition
 
         if (serverConfig.currentProfile.auxTextMode
             == Hazkey_Config_Profile.AuxTextMode.auxTextDisabled)
             || (serverConfig.currentProfile.auxTextMode
                 == Hazkey_Config_Profile.AuxTextMode.auxTextShowWhenCursorNotAtEnd
-                && hiragana.count == cursorPos)
+                && hiraganaCount == cursorPos)
         {
             return Hazkey_ResponseEnvelope.with {
                 $0.status = .success
@@ -239,9 +320,10 @@ class HazkeyServerState {
         return Hazkey_ResponseEnvelope.with {
             $0.status = .success
             $0.textWithCursor = Hazkey_Commands_TextWithCursor.with {
-                $0.beforeCursosr = safeSubstring(hiragana, start: 0, end: cursorPos)
-                $0.onCursor = safeSubstring(hiragana, start: cursorPos, end: cursorPos + 1)
-                $0.afterCursor = safeSubstring(hiragana, start: cursorPos + 1, end: hiragana.count)
+                $0.beforeCursosr = String(composingText.hiragana(from: 0, to: cursorPos))
+                $0.onCursor = String(composingText.hiragana(from: cursorPos, to: cursorPos + 1))
+                $0.afterCursor = String(
+                    composingText.hiragana(from: cursorPos + 1, to: hiraganaCount))
             }
         }
     }
@@ -253,7 +335,7 @@ class HazkeyServerState {
         let result: String
         switch charType {
         case .hiragana:
-            result = composingText.value.toHiragana()
+            result = composingText.hiragana
         case .katakanaFull:
             result = composingText.value.toKatakana(true)
         case .katakanaHalf:
@@ -330,28 +412,138 @@ class HazkeyServerState {
 
         options.requireJapanesePrediction = usePrediction ? .manualMix : .disabled
 
-        var copiedComposingText = composingText.value
+        let copiedComposingText = readingForConversion(complete: !is_suggest)
 
-        if !is_suggest {
-            let _ = copiedComposingText.moveCursorFromCursorPosition(
-                count: copiedComposingText.toHiragana().count)
-            copiedComposingText.insertAtCursorPosition(
-                [
-                    ComposingText.InputElement(
-                        piece: .compositionSeparator,
-                        inputStyle: .mapped(id: .tableName(currentTableName)))
-                ])
+        touchZenzai()
+        adoptWarmConverter()
+        dictionaryPreload.recordConversion()
+        let zenzaiReady = isZenzaiReady
+        let useZenzaiWorker = zenzaiReady && serverConfig.currentProfile.zenzaiIsolatedWorker
+        // live conversion is latency bound, so it goes to the draft model when there is one
+        let liveConverter = is_suggest && zenzaiReady && !useZenzaiWorker ? draftConverter : nil
+        let hiraganaPreedit = is_suggest ? composingText.hiragana : completeReading().hiragana
+        let hiraganaPreeditLen = hiraganaPreedit.count
+
+        // a longer reading keeps the predictions of the previous one that still match it
+        let cachedPredictions =
+            usePrediction
+            ? predictionCache.candidates(
+                for: hiraganaPreedit, inputCount: copiedComposingText.input.count) : nil
+        if cachedPredictions != nil {
+            options.requireJapanesePrediction = .disabled
+        }
+
+        // the inference limit is cut to fit the time budget, and follows the measured
+        // latency together with the context length when a latency target is set
+        let timeBudgetMs = Int(serverConfig.currentProfile.zenzaiTimeBudgetMs)
+        let latencyTargetMs = Int(serverConfig.currentProfile.zenzaiLatencyTargetMs)
+        let tuneZenzaiEffort =
+            zenzaiReady && (timeBudgetMs > 0 || latencyTargetMs > 0) && liveConverter == nil
+        let inferenceLimit = serverConfig.zenzaiInferenceLimit()
+        if !zenzaiReady || useZenzaiWorker {
+            // no Zenzai in this process while the model is loading or when the worker runs it
+            options.zenzaiMode = .off
+        } else if liveConverter != nil {
+            options.zenzaiMode = serverConfig.genZenzaiMode(leftContext: leftContext, draft: true)
+        } else if tuneZenzaiEffort {
+            options.zenzaiMode = serverConfig.genZenzaiMode(leftContext: leftContext)
+        }
+
+        let resizedClauseLength = is_suggest ? nil : clauseLength(for: hiraganaPreedit)
+
+        // a repeated conversion reuses the ranking Zenzai gave it before. A
+        // resized clause ranks only part of the candidates, so it is not cached
+        let zenzaiOptions = options
+        var scoreCacheKey: String?
+        var cachedRanking: [ZenzaiScoreCache.RankedCandidate]?
+        if zenzaiReady && !useZenzaiWorker && liveConverter == nil && resizedClauseLength == nil {
+            let key = zenzaiScoreCache.key(
+                contextWindow: serverConfig.zenzaiLeftContext(leftContext) ?? "",
+                reading: hiraganaPreedit, complete: !is_suggest,
+                inferenceLimit: inferenceLimit, nBest: N_best)
+            scoreCacheKey = key
+            cachedRanking = zenzaiScoreCache.lookup(key)
+            if cachedRanking != nil {
+                options.zenzaiMode = .off
+            }
         }
 
         var candidatesResult = Hazkey_Commands_CandidatesResult()
-        let converted = converter.requestCandidates(copiedComposingText, options: options)
-        let hiraganaPreedit = copiedComposingText.toHiragana()
-        let hiraganaPreeditLen = hiraganaPreedit.count
+        let conversionStart = DispatchTime.now()
+        // the worker runs Zenzai while the dictionary conversion runs here
+        let workerRequestSent =
+            useZenzaiWorker
+            && zenzaiWorker.send(
+                Hazkey_Worker_WorkerRequest.with {
+                    $0.reading = hiraganaPreedit
+                    $0.complete = !is_suggest
+                    $0.leftContext = serverConfig.zenzaiLeftContext(leftContext) ?? ""
+                    $0.inferenceLimit = Int32(inferenceLimit)
+                    $0.nBest = Int32(N_best)
+                })
+        let converted = (liveConverter ?? converter).requestCandidates(
+            copiedComposingText, options: options)
+        var mainResults = converted.mainResults
+        if let length = resizedClauseLength {
+            mainResults = clauseCandidates(
+                length: length, of: copiedComposingText, converted: mainResults,
+                options: options)
+        }
+        if workerRequestSent,
+            let ranked = zenzaiWorker.receive(timeoutMs: serverConfig.zenzaiWorkerTimeoutMs)
+        {
+            mainResults = rerankCandidates(
+                mainResults, by: ranked.map { ($0.text, Int($0.rubyCount)) })
+        }
+        if let key = scoreCacheKey {
+            if let ranked = cachedRanking {
+                let reranked = rerankCandidates(
+                    mainResults, by: ranked.map { ($0.text, $0.rubyCount) })
+                if reranked.first?.text == ranked.first?.text {
+                    mainResults = reranked
+                } else {
+                    // Zenzai wrote the top candidate itself, so the dictionary cannot give it back
+                    zenzaiScoreCache.markUncacheable(key)
+                    mainResults =
+                        converter.requestCandidates(copiedComposingText, options: zenzaiOptions)
+                        .mainResults
+                }
+            } else {
+                zenzaiScoreCache.store(
+                    key,
+                    ranked: mainResults.prefix(N_best).map {
+                        ZenzaiScoreCache.RankedCandidate(text: $0.text, rubyCount: $0.rubyCount)
+                    })
+            }
+        }
+        if tuneZenzaiEffort && cachedRanking == nil {
+            let elapsedNs = DispatchTime.now().uptimeNanoseconds - conversionStart.uptimeNanoseconds
+            let elapsedMs = Double(elapsedNs) / 1_000_000
+            if timeBudgetMs > 0 {
+                serverConfig.zenzaiBudget.record(
+                    elapsedMs: elapsedMs, inferenceLimit: inferenceLimit)
+            }
+            serverConfig.zenzaiController.record(
+                elapsedMs: elapsedMs, maxLimit: Int(serverConfig.currentProfile.zenzaiInferLimit),
+                targetMs: latencyTargetMs)
+        }
+        // the worker and the draft converter keep KV caches of their own, so
+        // only prompts of the main converter here can share a prefix
+        if zenzaiReady && !useZenzaiWorker && liveConverter == nil && cachedRanking == nil {
+            stats.recordZenzaiPrompt(
+                serverConfig.zenzaiPromptPrefix(leftContext: leftContext) + hiraganaPreedit)
+        }
         var serverCandidates: [Candidate] = []
         var clientCandidates: [Hazkey_Commands_CandidatesResult.Candidate] = []
 
+        let predictionResults = cachedPredictions ?? converted.predictionResults
+        if usePrediction && cachedPredictions == nil {
+            predictionCache.store(
+                reading: hiraganaPreedit, candidates: converted.predictionResults,
+                shownCount: N_best)
+        }
         // predictionResults is empty when prediction=disabled
-        for candidate in converted.predictionResults {
+        for candidate in predictionResults {
             guard
                 canAppend(
                     isSuggest: is_suggest, currentCount: serverCandidates.count, limit: N_best)
@@ -364,7 +556,7 @@ class HazkeyServerState {
         }
 
         candidatesResult.liveTextIndex = -1
-        for candidate in converted.mainResults {
+        for candidate in mainResults {
             let isExactMatch = candidate.rubyCount == hiraganaPreedit.count
             let limitReached = !canAppend(
                 isSuggest: is_suggest, currentCount: serverCandidates.count, limit: N_best)
@@ -390,6 +582,29 @@ class HazkeyServerState {
             )
         }
 
+        // candidates that consume all of the input go after the best one,
+        // which stays what was typed
+        func insertAfterBest(_ candidates: [Candidate]) {
+            let insertIndex = min(1, serverCandidates.count)
+            let newCandidates = candidates.filter { candidate in
+                !serverCandidates.contains { $0.text == candidate.text }
+            }
+            serverCandidates.insert(contentsOf: newCandidates, at: insertIndex)
+            clientCandidates.insert(
+                contentsOf: newCandidates.map { candidate in
+                    Hazkey_Commands_CandidatesResult.Candidate.with { $0.text = candidate.text }
+                }, at: insertIndex)
+            if candidatesResult.liveTextIndex >= insertIndex {
+                candidatesResult.liveTextIndex += Int32(newCandidates.count)
+            }
+        }
+        if !is_suggest && serverConfig.currentProfile.specialConversionMode.typoCorrection {
+            insertAfterBest(typoCorrectedCandidates(options: options))
+        }
+        if isSubInputMode && serverConfig.currentProfile.useEnglishPrediction {
+            insertAfterBest(englishPredictionCandidates(limit: N_best))
+        }
+
         self.currentCandidateList = serverCandidates
         candidatesResult.candidates = clientCandidates
 
@@ -426,8 +641,385 @@ class HazkeyServerState {
         }
     }
 
+    /// The composing text as it is converted. A complete conversion reads
+    /// all of it, with the pending romaji flushed.
+    private func readingForConversion(complete: Bool) -> ComposingText {
+        return complete ? completeReading().text : composingText.value
+    }
+
+    private func completeReading() -> (text: ComposingText, hiragana: String) {
+        let hiraganaCount = composingText.hiraganaCount
+        let tableName = currentTableName
+        return composingText.completed { value in
+            var reading = value
+            let _ = reading.moveCursorFromCursorPosition(
+                count: hiraganaCount - reading.convertTargetCursorPosition)
+            reading.insertAtCursorPosition(
+                [
+                    ComposingText.InputElement(
+                        piece: .compositionSeparator,
+                        inputStyle: .mapped(id: .tableName(tableName)))
+                ])
+            return reading
+        }
+    }
+
+    /// Candidates for the first `length` characters of the reading.
+    ///
+    /// The conversion of the whole reading already lists clauses of several
+    /// lengths, so those are used first. Only when they are too few is the
+    /// prefix converted, which the converter does from the lattice it kept
+    /// for the whole reading, as the input only lost its end.
+    private func clauseCandidates(
+        length: Int, of reading: ComposingText, converted: [Candidate],
+        options: ConvertRequestOptions
+    ) -> [Candidate] {
+        var candidates = converted.filter { $0.rubyCount == length }
+        guard candidates.count < options.N_best else { return candidates }
+
+        var prefix = reading
+        let _ = prefix.moveCursorFromCursorPosition(
+            count: length - prefix.convertTargetCursorPosition)
+        var prefixOptions = options
+        prefixOptions.zenzaiMode = .off
+        let prefixResults = converter.requestCandidates(
+            prefix.prefixToCursorPosition(), options: prefixOptions
+        ).mainResults
+        for candidate in prefixResults
+        where candidate.rubyCount == length
+            && !candidates.contains(where: { $0.text == candidate.text })
+        {
+            candidates.append(candidate)
+        }
+        return candidates
+    }
+
+    /// Converts corrected readings when the input table left some of the
+    /// typed keys unconverted. Each candidate covers a whole corrected
+    /// reading and consumes all of the typed keys.
+    private func typoCorrectedCandidates(options: ConvertRequestOptions) -> [Candidate] {
+        let typed = composingText.value
+        guard !isSubInputMode, !unconvertedLetters(typed.convertTarget).isEmpty else { return [] }
+        var keys: [Character] = []
+        for element in typed.input {
+            guard case .mapped = element.inputStyle else { return [] }
+            switch element.piece {
+            case .character(let character):
+                keys.append(character)
+            case .key(_, let input, _):
+                keys.append(input)
+            case .compositionSeparator:
+                continue
+            }
+        }
+
+        func reading(_ keys: [Character]) -> ComposingText {
+            var text = ComposingText()
+            text.insertAtCursorPosition(
+                keys.map(tableInputElement) + [
+                    ComposingText.InputElement(
+                        piece: .compositionSeparator,
+                        inputStyle: .mapped(id: .tableName(currentTableName)))
+                ])
+            return text
+        }
+        // the budget covers both the search and the conversions of what it finds
+        let deadline = DispatchTime.now() + .milliseconds(TYPO_CORRECTION_BUDGET_MS)
+        let corrections = typoCorrector.corrections(
+            of: keys, limit: TYPO_CORRECTION_MAX_READINGS, deadline: deadline
+        ) { unconvertedLetters(reading($0).convertTarget) }
+
+        var options = options
+        options.zenzaiMode = .off
+        options.requireJapanesePrediction = .disabled
+        var candidates: [Candidate] = []
+        for corrected in corrections where DispatchTime.now() < deadline {
+            let correctedText = reading(corrected)
+            let readingLength = correctedText.toHiragana().count
+            guard
+                var candidate = converter.requestCandidates(correctedText, options: options)
+                    .mainResults.first(where: { $0.rubyCount == readingLength })
+            else { continue }
+            candidate.composingCount = .inputCount(typed.input.count)
+            candidates.append(candidate)
+        }
+        return candidates
+    }
+
+    /// Completions of the word typed in sub input mode.
+    private func englishPredictionCandidates(limit: Int) -> [Candidate] {
+        // looked for once, not on every keystroke when it is not installed
+        if !isEnglishLexiconLoaded {
+            englishLexicon = getEnglishLexiconPath().flatMap { EnglishLexicon(url: $0) }
+            isEnglishLexiconLoaded = true
+        }
+        guard let lexicon = englishLexicon else { return [] }
+        let typed = composingText.value.convertTarget
+        // only the word being typed is completed, as in "きょうはHel" -> "きょうはHello"
+        let typedWord = String(
+            typed.reversed().prefix { $0.isASCII && ($0.isLetter || $0 == "'") }.reversed())
+        guard !typedWord.isEmpty else { return [] }
+        let head = String(typed.dropLast(typedWord.count))
+        // keep the case the word was started with, as in "Hel" -> "Hello"
+        let isCapitalized = typedWord.first?.isUppercase ?? false
+        let isAllUppercase = typedWord.count > 1 && typedWord.allSatisfy { !$0.isLowercase }
+
+        return lexicon.predictions(prefix: typedWord, limit: limit).map { word in
+            let text =
+                head
+                + (isAllUppercase
+                    ? word.uppercased()
+                    : isCapitalized ? word.prefix(1).uppercased() + word.dropFirst() : word)
+            return Candidate(
+                text: text, value: -20,
+                composingCount: .inputCount(composingText.value.input.count),
+                lastMid: MIDData.一般.mid,
+                data: [
+                    DicdataElement(
+                        word: text, ruby: typed, cid: CIDData.一般名詞.cid, mid: MIDData.一般.mid,
+                        value: -20)
+                ])
+        }
+    }
+
+    func getServerStats() -> Hazkey_ResponseEnvelope {
+        var serverStats = stats.toProto(scoreCache: zenzaiScoreCache)
+        if !serverConfig.isZenzaiEnabled {
+            serverStats.zenzai.modelState = .modelDisabled
+        } else if isZenzaiUnloaded {
+            serverStats.zenzai.modelState = .modelUnloaded
+        } else if serverConfig.currentProfile.zenzaiIsolatedWorker {
+            serverStats.zenzai.modelState = zenzaiWorker.checkReady() ? .modelReady : .modelLoading
+        } else {
+            serverStats.zenzai.modelState =
+                switch zenzaiWarmup.readiness {
+                case .disabled: .modelDisabled
+                case .loading: .modelLoading
+                case .ready: .modelReady
+                }
+        }
+        serverStats.zenzai.workerRestarts = zenzaiWorker.restarts
+        serverStats.zenzai.warmupMs = zenzaiWarmup.warmupMs
+        let latencyTargetMs = Int(serverConfig.currentProfile.zenzaiLatencyTargetMs)
+        serverStats.zenzai.inferenceLimit = UInt32(serverConfig.zenzaiInferenceLimit())
+        serverStats.zenzai.contextLength = UInt32(
+            serverConfig.zenzaiController.contextLength(targetMs: latencyTargetMs) ?? 0)
+        serverStats.zenzai.latencyP95Ms = serverConfig.zenzaiController.p95Ms ?? 0
+        serverStats.dictionary = dictionaryPreload.toProto()
+        serverStats.memory = currentMemoryStats()
+        serverStats.specialProviders = serverConfig.specialProviderStats.toProto()
+        return Hazkey_ResponseEnvelope.with {
+            $0.status = .success
+            $0.serverStats = serverStats
+        }
+    }
+
+    /// Zenzai
+
+    var isZenzaiReady: Bool {
+        guard serverConfig.isZenzaiEnabled else { return false }
+        if serverConfig.currentProfile.zenzaiIsolatedWorker {
+            return zenzaiWorker.checkReady()
+        }
+        return zenzaiWarmup.readiness == .ready
+    }
+
+    /// Loads the Zenzai model in the background unless the same model is already loaded.
+    func startZenzaiWarmup(force: Bool = false) {
+        isZenzaiUnloaded = false
+        lastZenzaiUse = DispatchTime.now()
+        guard serverConfig.isZenzaiEnabled, let modelPath = serverConfig.zenzaiModelPath else {
+            zenzaiWarmupKey = nil
+            zenzaiWarmup.stop()
+            zenzaiWorker.stop()
+            stopZenzaiDraftWarmup()
+            return
+        }
+        if serverConfig.currentProfile.zenzaiIsolatedWorker {
+            // the worker reads the profile when it starts, so it is restarted every time
+            zenzaiWarmupKey = nil
+            zenzaiWarmup.stop()
+            stopZenzaiDraftWarmup()
+            zenzaiWorker.start(
+                memoryLimitMb: Int(serverConfig.currentProfile.zenzaiWorkerMemoryLimitMb))
+            return
+        }
+        zenzaiWorker.stop()
+        startZenzaiDraftWarmup(force: force)
+        let key = modelPath.path + "\n" + serverConfig.currentProfile.zenzaiBackendDeviceName
+        guard force || key != zenzaiWarmupKey else { return }
+        zenzaiWarmupKey = key
+
+        var options = serverConfig.genBaseConvertRequestOptions()
+        options.learningType = .nothing
+        // the warm converter replaces the server one, so it has to bring the whole dictionary.
+        // It is the preloaded converter when the preload has not been adopted yet
+        options.preloadDictionary = true
+        let dictionaryURL = serverConfig.dictionaryPath
+        zenzaiWarmup.start(options: options) { [dictionaryPreload] in
+            dictionaryPreload.waitForPreloadedConverter()
+                ?? KanaKanjiConverter.init(dictionaryURL: dictionaryURL)
+        }
+    }
+
+    private func startZenzaiDraftWarmup(force: Bool) {
+        guard serverConfig.isZenzaiDraftEnabled, let draftPath = serverConfig.zenzaiDraftModelPath
+        else {
+            stopZenzaiDraftWarmup()
+            return
+        }
+        let key = draftPath.path + "\n" + serverConfig.currentProfile.zenzaiBackendDeviceName
+        guard force || key != zenzaiDraftWarmupKey else { return }
+        zenzaiDraftWarmupKey = key
+        draftConverter = nil
+
+        var options = serverConfig.genBaseConvertRequestOptions()
+        options.learningType = .nothing
+        options.zenzaiMode = serverConfig.genZenzaiMode(leftContext: "", draft: true)
+        // live conversion reads few dictionary shards, so the draft converter
+        // loads only those instead of holding a second copy of the dictionary
+        options.preloadDictionary = false
+        let dictionaryURL = serverConfig.dictionaryPath
+        zenzaiDraftWarmup.start(options: options) {
+            KanaKanjiConverter.init(dictionaryURL: dictionaryURL)
+        }
+    }
+
+    private func stopZenzaiDraftWarmup() {
+        zenzaiDraftWarmupKey = nil
+        zenzaiDraftWarmup.stop()
+        draftConverter = nil
+    }
+
+    /// Reloads the model released by unloadZenzaiIfIdle() in the background.
+    /// Conversion is dictionary-only until it is ready.
+    private func touchZenzai() {
+        if isZenzaiUnloaded {
+            NSLog("Reloading Zenzai model")
+            startZenzaiWarmup(force: true)
+        }
+        lastZenzaiUse = DispatchTime.now()
+    }
+
+    /// Releases the Zenzai model and its context once no conversion has run
+    /// for the idle timeout of the profile. Nothing is loaded again until
+    /// the next keystroke, which reloads the model and the dictionary with it.
+    func unloadZenzaiIfIdle() {
+        guard !isZenzaiUnloaded, serverConfig.isZenzaiEnabled,
+            let idleSeconds = serverConfig.zenzaiIdleUnloadSeconds,
+            DispatchTime.now().uptimeNanoseconds - lastZenzaiUse.uptimeNanoseconds
+                >= UInt64(idleSeconds) * 1_000_000_000
+        else { return }
+
+        let rssBeforeBytes = currentResidentBytes()
+        zenzaiWarmupKey = nil
+        zenzaiWarmup.stop()
+        zenzaiWorker.stop()
+        stopZenzaiDraftWarmup()
+        // the converter keeps the weights and the llama context once Zenzai has run on it
+        if learningDataNeedsCommit {
+            converter.commitUpdateLearningData()
+            learningDataNeedsCommit = false
+        }
+        converter = KanaKanjiConverter.init(dictionaryURL: serverConfig.dictionaryPath)
+        hasWarmZenzaiConverter = false
+        // give the freed heap back to the system
+        malloc_trim(0)
+        // before anything is loaded again, so that the figure is what the unload freed
+        let rssAfterBytes = currentResidentBytes()
+
+        isZenzaiUnloaded = true
+        stats.recordZenzaiUnload(rssBeforeBytes: rssBeforeBytes, rssAfterBytes: rssAfterBytes)
+        NSLog(
+            "Unloaded idle Zenzai model (RSS \(rssBeforeBytes / 1_048_576) MB -> \(rssAfterBytes / 1_048_576) MB)"
+        )
+    }
+
+    func reloadZenzaiModel() -> Hazkey_ResponseEnvelope {
+        serverConfig.reloadZenzaiModel()
+        configureZenzaiScoreCache()
+        baseConvertRequestOptions.zenzaiMode = serverConfig.genZenzaiMode(
+            leftContext: leftContext)
+        startZenzaiWarmup(force: true)
+        return Hazkey_ResponseEnvelope.with {
+            $0.status = .success
+        }
+    }
+
+    private func configureZenzaiScoreCache() {
+        zenzaiScoreCache.configure(
+            validityKey: serverConfig.zenzaiScoreCacheValidityKey(),
+            persistent: serverConfig.currentProfile.zenzaiPersistScoreCache)
+    }
+
+    /// Starts the benchmark or polls its result. With `applyFastest`, the
+    /// fastest device and thread count are saved to the profile once the run
+    /// has finished.
+    func benchmarkZenzai(start: Bool, applyFastest: Bool) -> Hazkey_ResponseEnvelope {
+        if start && !zenzaiBenchmark.result.running {
+            zenzaiBenchmark.start(
+                threadCounts: zenzaiBenchmarkThreadCounts(serverConfig.currentProfile))
+            applyZenzaiBenchmark = applyFastest
+        }
+        var result = zenzaiBenchmark.result
+        if applyZenzaiBenchmark && !result.running && !result.fastestDeviceName.isEmpty {
+            applyZenzaiBenchmark = false
+            var profiles = serverConfig.profiles
+            profiles[0].zenzaiBackendDeviceName = result.fastestDeviceName
+            profiles[0].zenzaiThreads = result.fastestThreads
+            do {
+                try serverConfig.saveConfig(profiles, state: self)
+                zenzaiBenchmark.markApplied()
+                result.applied = true
+            } catch {
+                NSLog("Failed to apply Zenzai benchmark result: \(error)")
+            }
+        }
+        return Hazkey_ResponseEnvelope.with {
+            $0.status = .success
+            $0.zenzaiBenchmarkResult = result
+        }
+    }
+
+    /// Switches to the converters that have the Zenzai models loaded.
+    private func adoptWarmConverter() {
+        if let warmDraftConverter = zenzaiDraftWarmup.takeWarmConverter() {
+            draftConverter = warmDraftConverter
+        }
+        // a warm Zenzai converter has preloaded the dictionary as well, and a
+        // running warmup takes the preloaded converter for itself
+        if !hasWarmZenzaiConverter, zenzaiWarmup.readiness != .loading,
+            let preloadedConverter = dictionaryPreload.takePreloadedConverter()
+        {
+            replaceConverter(with: preloadedConverter)
+        }
+        guard let warmConverter = zenzaiWarmup.takeWarmConverter() else { return }
+        replaceConverter(with: warmConverter)
+        hasWarmZenzaiConverter = true
+    }
+
+    private func replaceConverter(with newConverter: KanaKanjiConverter) {
+        if learningDataNeedsCommit {
+            converter.commitUpdateLearningData()
+            learningDataNeedsCommit = false
+        }
+        converter = newConverter
+    }
+
+    /// Loads every dictionary shard in the background, for the converter
+    /// that is used until a warm Zenzai converter takes over.
+    func startDictionaryPreload() {
+        var options = serverConfig.genBaseConvertRequestOptions()
+        options.learningType = .nothing
+        options.zenzaiMode = .off
+        dictionaryPreload.start(dictionaryURL: serverConfig.dictionaryPath, options: options)
+    }
+
     func clearProfileLearningData() -> Hazkey_ResponseEnvelope {
         converter.resetMemory()
+        draftConverter?.resetMemory()
+        zenzaiScoreCache.clear()
+        reconversionIndex.removeAll()
         return Hazkey_ResponseEnvelope.with {
             $0.status = .success
         }
@@ -437,12 +1029,23 @@ class HazkeyServerState {
         NSLog("Reinitializing state configuration...")
 
         self.keymap = serverConfig.loadKeymap()
+        self.typoCorrector = TypoCorrector(keymap: keymap)
 
         let newTableName = UUID().uuidString
         serverConfig.loadInputTable(tableName: newTableName)
         self.currentTableName = newTableName
+        self.compiledKeymap = CompiledKeymap(keymap: keymap, tableName: newTableName)
 
+        self.leftContext = ""
+        self.leftContextWindow.reset()
+        self.predictionCache.reset()
+        serverConfig.zenzaiBudget.reset()
+        // a lexicon installed since is found on the next English prediction
+        self.englishLexicon = nil
+        self.isEnglishLexiconLoaded = false
         self.baseConvertRequestOptions = serverConfig.genBaseConvertRequestOptions()
+        configureZenzaiScoreCache()
+        startZenzaiWarmup()
 
         self.composingText = ComposingTextBox()
         self.currentCandidateList = nil
@@ -7,15 +7,8 @@ extension ComposingText {
     }
 
     func toKatakana(_ fullwidth: Bool) -> String {
-        let hiragana = self.toHiragana()
-        let katakanaFullwidth =
-            hiragana.applyingTransform(.hiraganaToKatakana, reverse: false) ?? hiragana
-        if fullwidth {
-            return katakanaFullwidth
-        } else {
-            return katakanaFullwidth.applyingTransform(.fullwidthToHalfwidth, reverse: false)
-                ?? katakanaFullwidth
-        }
+        let katakanaFullwidth = TextWidthTables.katakana(self.toHiragana())
+        return fullwidth ? katakanaFullwidth : TextWidthTables.halfwidth(katakanaFullwidth)
     }
 
     func toAlphabet(_ fullwidth: Bool) -> String {
@@ -29,7 +22,126 @@ extension ComposingText {
                 return nil
             }
         }
-        return String(romaji).applyingTransform(.fullwidthToHalfwidth, reverse: fullwidth) ?? ""
+        return fullwidth
+            ? TextWidthTables.fullwidth(String(romaji)) : TextWidthTables.halfwidth(String(romaji))
+    }
+}
+
+/// Kana and width conversions of the composing text by codepoint tables.
+///
+/// These give the results of the ICU transforms hiraganaToKatakana and
+/// fullwidthToHalfwidth for kana, ASCII and the Japanese punctuation,
+/// without going through the ICU transliterator on every F7-F10 press.
+enum TextWidthTables {
+    private static let katakanaBlock: ClosedRange<UInt32> = 0x30A0...0x30FF
+    private static let fullwidthASCII: ClosedRange<UInt32> = 0xFF01...0xFF5E
+    private static let fullwidthOffset: UInt32 = 0xFEE0
+    private static let ideographicSpace: UInt32 = 0x3000
+
+    // half width forms of the katakana block, indexed from its start;
+    // voiced kana are decomposed into the base kana and a sound mark
+    private static let halfwidthKatakana: [[Unicode.Scalar]] = {
+        let fullwidthBase = [
+            "ァアィイゥウェエォオ", "カキクケコサシスセソ", "タチッツテトナニヌネノ",
+            "ハヒフヘホマミムメモ", "ャヤュユョヨラリルレロ", "ワヲン・ー",
+        ].joined().unicodeScalars
+        let halfwidthBase = [
+            "ｧｱｨｲｩｳｪｴｫｵ", "ｶｷｸｹｺｻｼｽｾｿ", "ﾀﾁｯﾂﾃﾄﾅﾆﾇﾈﾉ",
+            "ﾊﾋﾌﾍﾎﾏﾐﾑﾒﾓ", "ｬﾔｭﾕｮﾖﾗﾘﾙﾚﾛ", "ﾜｦﾝ･ｰ",
+        ].joined().unicodeScalars
+        var base: [Unicode.Scalar: Unicode.Scalar] = [:]
+        for (full, half) in zip(fullwidthBase, halfwidthBase) {
+            base[full] = half
+        }
+        let soundMarks: [Unicode.Scalar: Unicode.Scalar] = [
+            "\u{3099}": "ﾞ", "\u{309A}": "ﾟ", "゛": "ﾞ", "゜": "ﾟ",
+        ]
+
+        return katakanaBlock.map { value in
+            guard let scalar = Unicode.Scalar(value) else { return [] }
+            let decomposed = Array(
+                String(scalar).decomposedStringWithCanonicalMapping.unicodeScalars)
+            guard let half = base[decomposed[0]] else { return [] }
+            var mapped = [half]
+            for mark in decomposed.dropFirst() {
+                guard let halfMark = soundMarks[mark] else { return [] }
+                mapped.append(halfMark)
+            }
+            return mapped
+        }
+    }()
+
+    // other characters that have a half width form
+    private static let halfwidthSymbols: [UInt32: Unicode.Scalar] = [
+        0x3001: "､", 0x3002: "｡", 0x300C: "｢", 0x300D: "｣", 0x3099: "ﾞ", 0x309A: "ﾟ",
+        0x309B: "ﾞ", 0x309C: "ﾟ", 0xFFE0: "\u{A2}", 0xFFE1: "\u{A3}", 0xFFE2: "\u{AC}",
+        0xFFE3: "\u{AF}", 0xFFE4: "\u{A6}", 0xFFE5: "\u{A5}", 0xFFE6: "\u{20A9}",
+    ]
+
+    static func katakana(_ hiragana: String) -> String {
+        var result = String.UnicodeScalarView()
+        for scalar in hiragana.unicodeScalars {
+            switch scalar.value {
+            // ぁ-ゖ and ゝゞ sit 0x60 below their katakana
+            case 0x3041...0x3096, 0x309D...0x309E:
+                result.append(Unicode.Scalar(scalar.value + 0x60)!)
+            default:
+                result.append(scalar)
+            }
+        }
+        return String(result)
+    }
+
+    /// The reverse of katakana(_:), for the readings of dictionary entries.
+    static func hiragana(_ katakana: String) -> String {
+        var result = String.UnicodeScalarView()
+        for scalar in katakana.unicodeScalars {
+            switch scalar.value {
+            case 0x30A1...0x30F6, 0x30FD...0x30FE:
+                result.append(Unicode.Scalar(scalar.value - 0x60)!)
+            default:
+                result.append(scalar)
+            }
+        }
+        return String(result)
+    }
+
+    static func halfwidth(_ text: String) -> String {
+        var result = String.UnicodeScalarView()
+        for scalar in text.unicodeScalars {
+            let value = scalar.value
+            if fullwidthASCII.contains(value) {
+                result.append(Unicode.Scalar(value - fullwidthOffset)!)
+            } else if value == ideographicSpace {
+                result.append(" ")
+            } else if katakanaBlock.contains(value),
+                case let mapped = halfwidthKatakana[Int(value - katakanaBlock.lowerBound)],
+                !mapped.isEmpty
+            {
+                result.append(contentsOf: mapped)
+            } else if let symbol = halfwidthSymbols[value] {
+                result.append(symbol)
+            } else {
+                result.append(scalar)
+            }
+        }
+        return String(result)
+    }
+
+    /// Full width forms of ASCII. Only ASCII is converted, as the romaji is.
+    static func fullwidth(_ text: String) -> String {
+        var result = String.UnicodeScalarView()
+        for scalar in text.unicodeScalars {
+            let value = scalar.value
+            if value == 0x20 {
+                result.append(Unicode.Scalar(ideographicSpace)!)
+            } else if fullwidthASCII.contains(value + fullwidthOffset) {
+                result.append(Unicode.Scalar(value + fullwidthOffset)!)
+            } else {
+                result.append(scalar)
+            }
+        }
+        return String(result)
     }
 }
 
@@ -0,0 +1,161 @@
+import Foundation
+
+// Time a keystroke may spend on typo correction, including the conversions
+// of the corrected readings, on top of the normal conversion
+let TYPO_CORRECTION_BUDGET_MS = 5
+// corrected readings tried per conversion, each costs a conversion of its own
+let TYPO_CORRECTION_MAX_READINGS = 2
+private let typoCorrectionMaxEdits = 2
+private let typoCorrectionMaxVariants = 512
+// keys on each side of the unconverted ones where edits are tried
+private let typoCorrectionEditWindow = 2
+
+// JIS layout; every row is shifted about half a key to the right of the one above
+private let keyboardRows: [[Character]] = [
+    Array("1234567890-^\\"),
+    Array("qwertyuiop@["),
+    Array("asdfghjkl;:]"),
+    Array("zxcvbnm,./\\"),
+]
+// left, right, upper left, upper right, lower left and lower right
+private let adjacentKeyOffsets = [(0, -1), (0, 1), (-1, 0), (-1, 1), (1, -1), (1, 0)]
+
+/// Finds readings within a small edit distance of mistyped keys.
+///
+/// Edits are substitutions by an adjacent key, deletions, insertions of an
+/// adjacent key or a vowel, and swaps of neighbouring keys. They are only made
+/// near the keys the input table leaves unconverted, as a mistyped key breaks
+/// the syllable it is in and the ones right after it. Variants are made one
+/// edit at a time, and a variant is only expanded further while it leaves
+/// fewer keys unconverted than the one it was made from.
+struct TypoCorrector {
+    private let neighbors: [Character: [Character]]
+
+    /// Adjacency follows the physical layout. The edits are made on the keys
+    /// as the input records them, which is the key itself unless the keymap
+    /// overrides its input character, and the keymap applies when they are
+    /// read again. The neighbours are therefore keyed by the physical key,
+    /// not by what it types.
+    init(keymap: Keymap) {
+        func recorded(_ key: Character) -> Character {
+            return keymap[key]?.1 ?? key
+        }
+        var neighbors: [Character: [Character]] = [:]
+        for (row, keys) in keyboardRows.enumerated() {
+            for (column, key) in keys.enumerated() {
+                var adjacent: [Character] = []
+                for (rowOffset, columnOffset) in adjacentKeyOffsets {
+                    let neighborRow = row + rowOffset
+                    let neighborColumn = column + columnOffset
+                    guard keyboardRows.indices.contains(neighborRow),
+                        keyboardRows[neighborRow].indices.contains(neighborColumn)
+                    else { continue }
+                    adjacent.append(recorded(keyboardRows[neighborRow][neighborColumn]))
+                }
+                neighbors[recorded(key), default: []].append(contentsOf: adjacent)
+            }
+        }
+        self.neighbors = neighbors
+    }
+
+    /// Returns up to `limit` corrected key sequences that `unconverted`
+    /// reports as fully converted, fewest edits first.
+    ///
+    /// - Parameter unconverted: the letters the input table leaves unconverted
+    func corrections(
+        of keys: [Character], limit: Int, deadline: DispatchTime,
+        unconverted: ([Character]) -> [Character]
+    ) -> [[Character]] {
+        var results: [[Character]] = []
+        var seen: Set<[Character]> = [keys]
+        var frontier: [(keys: [Character], unconverted: [Character])] = [
+            (keys, unconverted(keys))
+        ]
+
+        for _ in 0..<typoCorrectionMaxEdits {
+            var next: [(keys: [Character], unconverted: [Character])] = []
+            for parent in frontier {
+                let window = editWindow(of: parent.keys, unconverted: parent.unconverted)
+                for variant in edits(of: parent.keys, within: window)
+                where seen.insert(variant).inserted {
+                    guard seen.count <= typoCorrectionMaxVariants,
+                        DispatchTime.now() < deadline
+                    else { return results }
+                    let letters = unconverted(variant)
+                    if letters.isEmpty {
+                        results.append(variant)
+                        if results.count >= limit { return results }
+                    } else if letters.count < parent.unconverted.count {
+                        next.append((variant, letters))
+                    }
+                }
+            }
+            frontier = next
+        }
+        return results
+    }
+
+    /// Positions around the keys that typed the unconverted letters, where
+    /// keys are edited and inserted.
+    private func editWindow(
+        of keys: [Character], unconverted letters: [Character]
+    ) -> ClosedRange<Int> {
+        // the letters are left as they were typed, so they are matched to the keys from the end
+        var first = keys.count
+        var last = -1
+        var index = keys.count - 1
+        for letter in letters.reversed() {
+            while index >= 0 && keys[index] != letter {
+                index -= 1
+            }
+            guard index >= 0 else { return 0...keys.count }
+            last = max(last, index)
+            first = index
+            index -= 1
+        }
+        guard last >= 0 else { return 0...keys.count }
+        return max(0, first - typoCorrectionEditWindow)...min(
+            keys.count, last + 1 + typoCorrectionEditWindow)
+    }
+
+    private func edits(of keys: [Character], within window: ClosedRange<Int>) -> [[Character]] {
+        var variants: [[Character]] = []
+        for index in keys.indices where window.contains(index) {
+            let key = keys[index]
+            for neighbor in neighbors[key] ?? [] where neighbor != key {
+                var substituted = keys
+                substituted[index] = neighbor
+                variants.append(substituted)
+            }
+            if index + 1 < keys.count && keys[index] != keys[index + 1] {
+                var swapped = keys
+                swapped.swapAt(index, index + 1)
+                variants.append(swapped)
+            }
+            var deleted = keys
+            deleted.remove(at: index)
+            if !deleted.isEmpty {
+                variants.append(deleted)
+            }
+        }
+        // most missed keys in romaji are vowels
+        for index in window {
+            var inserted = Set("aiueo")
+            if index > 0 {
+                inserted.formUnion(neighbors[keys[index - 1]] ?? [])
+            }
+            for key in inserted {
+                var variant = keys
+                variant.insert(key, at: index)
+                variants.append(variant)
+            }
+        }
+        return variants
+    }
+}
+
+/// The characters of a reading that are not kana, which the input table
+/// leaves when it cannot convert the typed keys.
+func unconvertedLetters(_ reading: String) -> [Character] {
+    return Array(reading.filter { $0.isASCII && $0.isLetter })
+}
@@ -12,3 +12,38 @@ public func debugLog(
         }
     #endif
 }
+
+/// Resident set size of this process, from /proc/self/statm
+func currentResidentBytes() -> UInt64 {
+    guard let statm = try? String(contentsOfFile: "/proc/self/statm", encoding: .utf8) else {
+        return 0
+    }
+    let fields = statm.split(separator: " ")
+    guard fields.count > 1, let residentPages = UInt64(fields[1]) else {
+        return 0
+    }
+    return residentPages * UInt64(sysconf(Int32(_SC_PAGESIZE)))
+}
+
+/// Resident set size of this process split by kind, from /proc/self/status.
+/// Anonymous memory is private to the process, while file pages are shared
+/// with every process that maps the same files.
+func currentMemoryStats() -> Hazkey_Commands_ServerStats.MemoryStats {
+    var memory = Hazkey_Commands_ServerStats.MemoryStats()
+    guard let status = try? String(contentsOfFile: "/proc/self/status", encoding: .utf8) else {
+        return memory
+    }
+    for line in status.split(separator: "\n") {
+        // "RssAnon:     12345 kB"
+        let fields = line.split(whereSeparator: { $0 == ":" || $0 == " " || $0 == "\t" })
+        guard fields.count >= 2, let kilobytes = UInt64(fields[1]) else { continue }
+        switch fields[0] {
+        case "VmRSS": memory.rssBytes = kilobytes * 1024
+        case "RssAnon": memory.rssAnonBytes = kilobytes * 1024
+        case "RssFile": memory.rssFileBytes = kilobytes * 1024
+        case "RssShmem": memory.rssShmemBytes = kilobytes * 1024
+        default: break
+        }
+    }
+    return memory
+}
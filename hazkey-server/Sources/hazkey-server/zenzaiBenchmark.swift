@@ -0,0 +1,246 @@
+import Foundation
+import KanaKanjiConverterModule
+import SwiftProtobuf
+
+// Readings converted on every device, from short phrases to a full sentence
+private let benchmarkReadings = [
+    "へんかん",
+    "きょうはいいてんきですね",
+    "かいぎのしりょうをおくります",
+    "あしたのよていをかくにんしてください",
+    "しんかんせんのきっぷをよやくしました",
+    "このぷろぐらむはにほんごにゅうりょくをたすけます",
+]
+private let benchmarkRounds = 3
+// thread counts compared on every device, halving from the usable CPUs
+private let benchmarkMaxThreadCounts = 3
+
+/// Thread counts the benchmark compares: the CPUs Zenzai may use under the
+/// profile, halved while that leaves at least two, and the thread count of
+/// the profile.
+func zenzaiBenchmarkThreadCounts(_ profile: Hazkey_Config_Profile) -> [Int] {
+    var threads =
+        zenzaiAllowedCPUs(profile)?.count ?? ProcessInfo.processInfo.activeProcessorCount
+    var counts: Set<Int> = []
+    while threads >= 1 && counts.count < benchmarkMaxThreadCounts {
+        counts.insert(threads)
+        if threads < 4 { break }
+        threads /= 2
+    }
+    if profile.zenzaiThreads > 0 {
+        counts.insert(Int(profile.zenzaiThreads))
+    }
+    return counts.sorted(by: >)
+}
+
+/// Converts the benchmark readings with Zenzai on every GGML device, with the
+/// draft model too when there is one.
+///
+/// Every installed backend gets loaded, and the CPU backend takes its thread
+/// count from the environment once, so this is meant to run in its own
+/// process (--bench-zenzai --serialized) for each thread count rather than
+/// in the server.
+func runZenzaiBenchmark() -> Hazkey_Config_ZenzaiBenchmarkResult {
+    let config = HazkeyServerConfig()
+    guard config.zenzaiModelPath != nil else {
+        return Hazkey_Config_ZenzaiBenchmarkResult.with {
+            $0.errorMessage = "Zenzai model not found"
+        }
+    }
+    let devices = config.ggmlBackendLoader.loadAll()
+    // set from the profile or HAZKEY_ZENZAI_THREADS by HazkeyServerConfig
+    let threads = ProcessInfo.processInfo.environment["OMP_THREAD_LIMIT"].flatMap { Int($0) } ?? 0
+    config.currentProfile.zenzaiEnable = true
+    // measure the configured inference limit, not the tuned one
+    config.currentProfile.zenzaiTimeBudgetMs = 0
+    config.currentProfile.zenzaiLatencyTargetMs = 0
+    config.currentProfile.zenzaiContextualMode = false
+
+    // returns the latency of every conversion and the characters read and written
+    func measure(deviceName: String, draft: Bool) -> (latenciesMs: [Double], characters: Int) {
+        config.currentProfile.zenzaiBackendDeviceName = deviceName
+        let converter = KanaKanjiConverter.init(dictionaryURL: config.dictionaryPath)
+        var options = config.genBaseConvertRequestOptions()
+        options.learningType = .nothing
+        options.zenzaiMode = config.genZenzaiMode(leftContext: "", draft: draft)
+
+        func convert(_ reading: String) -> Int {
+            var composingText = ComposingText()
+            composingText.insertAtCursorPosition(reading, inputStyle: .direct)
+            let converted = converter.requestCandidates(composingText, options: options)
+            return reading.count + (converted.mainResults.first?.text.count ?? 0)
+        }
+
+        // the first conversion loads the model
+        let _ = convert(benchmarkReadings[0])
+
+        var latenciesMs: [Double] = []
+        var characters = 0
+        for _ in 0..<benchmarkRounds {
+            for reading in benchmarkReadings {
+                let start = DispatchTime.now()
+                characters += convert(reading)
+                latenciesMs.append(
+                    Double(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds)
+                        / 1_000_000)
+            }
+        }
+        return (latenciesMs, characters)
+    }
+
+    var results: [Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult] = []
+    for device in devices {
+        NSLog("Benchmarking Zenzai on \(device.name)")
+        let (latenciesMs, characters) = measure(deviceName: device.name, draft: false)
+        let totalMs = latenciesMs.reduce(0, +)
+        var result = Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult.with {
+            $0.deviceName = device.name
+            $0.deviceDesc = device.description
+            $0.threads = Int32(threads)
+            $0.conversions = Int32(latenciesMs.count)
+            $0.meanLatencyMs = totalMs / Double(latenciesMs.count)
+            $0.maxLatencyMs = latenciesMs.max() ?? 0
+            $0.charsPerSecond = totalMs > 0 ? Double(characters) * 1000 / totalMs : 0
+        }
+        if config.zenzaiDraftModelPath != nil {
+            let (draftLatenciesMs, draftCharacters) = measure(deviceName: device.name, draft: true)
+            let draftTotalMs = draftLatenciesMs.reduce(0, +)
+            result.draftMeanLatencyMs = draftTotalMs / Double(draftLatenciesMs.count)
+            result.draftCharsPerSecond =
+                draftTotalMs > 0 ? Double(draftCharacters) * 1000 / draftTotalMs : 0
+        }
+        results.append(result)
+    }
+
+    return Hazkey_Config_ZenzaiBenchmarkResult.with {
+        $0.results = results
+    }
+}
+
+/// Runs the benchmark in a child process for each of `threadCounts` and
+/// picks the fastest device and thread count of all runs.
+func runZenzaiBenchmarkSweep(threadCounts: [Int]) -> Hazkey_Config_ZenzaiBenchmarkResult {
+    var results: [Hazkey_Config_ZenzaiBenchmarkResult.DeviceResult] = []
+    var errorMessage = ""
+    // one run at a time, so that the runs do not compete for the CPU
+    for threads in threadCounts {
+        NSLog("Benchmarking Zenzai with \(threads) threads")
+        let result = runZenzaiBenchmarkChild(threads: threads)
+        if !result.errorMessage.isEmpty {
+            errorMessage = result.errorMessage
+        }
+        results += result.results
+    }
+
+    let fastest = results.min { $0.meanLatencyMs < $1.meanLatencyMs }
+    return Hazkey_Config_ZenzaiBenchmarkResult.with {
+        $0.results = results
+        $0.fastestDeviceName = fastest?.deviceName ?? ""
+        $0.fastestThreads = fastest?.threads ?? 0
+        // a failed run is only reported when no run gave a result
+        $0.errorMessage = results.isEmpty ? errorMessage : ""
+    }
+}
+
+private func runZenzaiBenchmarkChild(threads: Int) -> Hazkey_Config_ZenzaiBenchmarkResult {
+    let process = Process()
+    process.executableURL = URL(fileURLWithPath: "/proc/self/exe")
+    process.arguments = ["--bench-zenzai", "--serialized"]
+    process.environment = ProcessInfo.processInfo.environment.merging(
+        ["HAZKEY_ZENZAI_THREADS": "\(threads)"]
+    ) { $1 }
+    let output = Pipe()
+    process.standardOutput = output
+    do {
+        try process.run()
+    } catch {
+        NSLog("Failed to start Zenzai benchmark: \(error)")
+        return Hazkey_Config_ZenzaiBenchmarkResult.with {
+            $0.errorMessage = "\(error)"
+        }
+    }
+    let data = output.fileHandleForReading.readDataToEndOfFile()
+    process.waitUntilExit()
+    guard process.terminationStatus == 0,
+        let result = try? Hazkey_Config_ZenzaiBenchmarkResult(serializedBytes: data)
+    else {
+        NSLog("Zenzai benchmark failed: exit status \(process.terminationStatus)")
+        return Hazkey_Config_ZenzaiBenchmarkResult.with {
+            $0.errorMessage = "Benchmark exited with status \(process.terminationStatus)"
+        }
+    }
+    return result
+}
+
+/// Entry point of --bench-zenzai. With --serialized a single run with the
+/// thread count of the environment is written as a ZenzaiBenchmarkResult
+/// message. Otherwise every thread count is compared and printed as a table.
+func printZenzaiBenchmark(serialized: Bool) -> Int32 {
+    if serialized {
+        guard let data = try? runZenzaiBenchmark().serializedData() else {
+            return 1
+        }
+        FileHandle.standardOutput.write(data)
+        return 0
+    }
+
+    let profile =
+        (try? HazkeyServerConfig.loadConfig())?.first ?? HazkeyServerConfig.genDefaultConfig()
+    let result = runZenzaiBenchmarkSweep(threadCounts: zenzaiBenchmarkThreadCounts(profile))
+    if !result.errorMessage.isEmpty {
+        print("Error: \(result.errorMessage)")
+        return 1
+    }
+    print(
+        "Device\tthreads\tms/conversion\tmax ms\tchars/s\tdraft ms/conversion\tDescription")
+    for device in result.results {
+        let numbers = [
+            device.meanLatencyMs, device.maxLatencyMs, device.charsPerSecond,
+            device.draftMeanLatencyMs,
+        ].map {
+            String(format: "%.1f", $0)
+        }
+        print(
+            ([device.deviceName, "\(device.threads)"] + numbers + [device.deviceDesc])
+                .joined(separator: "\t"))
+    }
+    print("Fastest: \(result.fastestDeviceName) with \(result.fastestThreads) threads")
+    return 0
+}
+
+/// Runs --bench-zenzai in child processes for the server.
+final class ZenzaiBenchmark: @unchecked Sendable {
+    private let lock = NSLock()
+    private let queue = DispatchQueue(
+        label: "dev.hiira.hazkey.server.zenzai-benchmark", qos: .utility)
+
+    // guarded by lock
+    private var _result = Hazkey_Config_ZenzaiBenchmarkResult()
+
+    /// Result of the last run, with `running` set while a run is in progress.
+    var result: Hazkey_Config_ZenzaiBenchmarkResult {
+        lock.lock()
+        defer { lock.unlock() }
+        return _result
+    }
+
+    func start(threadCounts: [Int]) {
+        lock.lock()
+        defer { lock.unlock() }
+        guard !_result.running else { return }
+        _result = Hazkey_Config_ZenzaiBenchmarkResult.with { $0.running = true }
+
+        queue.async { [self] in
+            let result = runZenzaiBenchmarkSweep(threadCounts: threadCounts)
+            lock.lock()
+            defer { lock.unlock() }
+            _result = result
+        }
+    }
+
+    func markApplied() {
+        lock.lock()
+        defer { lock.unlock() }
+        _result.applied = true
+    }
+}
@@ -0,0 +1,36 @@
+import Foundation
+
+/// Keeps Zenzai conversions within a wall-clock budget.
+///
+/// The converter only accepts a fixed number of Zenzai evaluations, so the
+/// deadline is honored by deriving that number from the measured cost of a
+/// single evaluation on this machine.
+final class ZenzaiInferenceBudget {
+    /// Smoothed conversion time per evaluation, in milliseconds.
+    private(set) var msPerEvaluation: Double?
+    private let smoothingFactor = 0.2
+
+    func inferenceLimit(maxLimit: Int, budgetMs: Int) -> Int {
+        let maxLimit = max(1, maxLimit)
+        guard budgetMs > 0, let cost = msPerEvaluation, cost > 0 else {
+            return maxLimit
+        }
+        return min(maxLimit, max(1, Int(Double(budgetMs) / cost)))
+    }
+
+    func record(elapsedMs: Double, inferenceLimit: Int) {
+        guard inferenceLimit > 0 else { return }
+        // The whole conversion is attributed to Zenzai, so dictionary lookup
+        // time is covered by the budget as well.
+        let sample = elapsedMs / Double(inferenceLimit)
+        if let current = msPerEvaluation {
+            msPerEvaluation = current + smoothingFactor * (sample - current)
+        } else {
+            msPerEvaluation = sample
+        }
+    }
+
+    func reset() {
+        msPerEvaluation = nil
+    }
+}
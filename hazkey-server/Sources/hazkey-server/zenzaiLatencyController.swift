@@ -0,0 +1,118 @@
+import Foundation
+
+/// Tunes Zenzai effort so that the 95th percentile conversion time stays
+/// within a target.
+///
+/// The converter only accepts a fixed number of Zenzai evaluations and a
+/// left context, so the controller adjusts those two from the latencies
+/// measured on this machine. The chosen values are stored per backend device
+/// and restored on the next start.
+final class ZenzaiLatencyController {
+    struct Tuning: Codable, Equatable {
+        var inferenceLimit: Int
+        var contextLength: Int
+    }
+
+    static let maxContextLength = 128
+    private static let minContextLength = 16
+    private static let windowSize = 32
+    private static let minSamples = 8
+
+    private var samples: [Double] = []
+    private var deviceName = ""
+    private(set) var tuning: Tuning?
+
+    private let storeURL: URL
+
+    init(storeURL: URL) {
+        self.storeURL = storeURL
+    }
+
+    /// Forgets the measured latencies and restores the values stored for the device.
+    func load(deviceName: String) {
+        self.deviceName = deviceName
+        samples.removeAll()
+        tuning = loadStore()[deviceName]
+    }
+
+    func inferenceLimit(maxLimit: Int, targetMs: Int) -> Int {
+        let maxLimit = max(1, maxLimit)
+        guard targetMs > 0, let tuning = tuning else { return maxLimit }
+        return min(maxLimit, tuning.inferenceLimit)
+    }
+
+    /// Number of left context characters passed to Zenzai, or nil for no limit.
+    func contextLength(targetMs: Int) -> Int? {
+        guard targetMs > 0, let tuning = tuning else { return nil }
+        return tuning.contextLength
+    }
+
+    var p95Ms: Double? {
+        guard !samples.isEmpty else { return nil }
+        let sorted = samples.sorted()
+        return sorted[min(sorted.count - 1, Int(Double(sorted.count) * 0.95))]
+    }
+
+    func record(elapsedMs: Double, maxLimit: Int, targetMs: Int) {
+        guard targetMs > 0 else { return }
+        samples.append(elapsedMs)
+        if samples.count > Self.windowSize {
+            samples.removeFirst(samples.count - Self.windowSize)
+        }
+        guard samples.count >= Self.minSamples, let p95 = p95Ms else { return }
+
+        let maxLimit = max(1, maxLimit)
+        let current =
+            tuning
+            ?? Tuning(inferenceLimit: maxLimit, contextLength: Self.maxContextLength)
+        var next = current
+        next.inferenceLimit = min(next.inferenceLimit, maxLimit)
+
+        if p95 > Double(targetMs) {
+            // cut the evaluations first, they dominate the cost
+            if next.inferenceLimit > 1 {
+                next.inferenceLimit = max(1, next.inferenceLimit * 3 / 4)
+            } else {
+                next.contextLength = max(Self.minContextLength, next.contextLength / 2)
+            }
+        } else if p95 < Double(targetMs) * 0.6 {
+            if next.contextLength < Self.maxContextLength {
+                next.contextLength = min(Self.maxContextLength, next.contextLength * 2)
+            } else if next.inferenceLimit < maxLimit {
+                next.inferenceLimit += 1
+            }
+        }
+
+        guard next != current else { return }
+        NSLog(
+            "Zenzai p95 \(Int(p95)) ms (target \(targetMs) ms): inference limit \(next.inferenceLimit), context \(next.contextLength) chars on \(deviceName)"
+        )
+        tuning = next
+        // the window was measured with the old values
+        samples.removeAll()
+        saveStore()
+    }
+
+    private func loadStore() -> [String: Tuning] {
+        guard let data = try? Data(contentsOf: storeURL),
+            let store = try? JSONDecoder().decode([String: Tuning].self, from: data)
+        else {
+            return [:]
+        }
+        return store
+    }
+
+    private func saveStore() {
+        var store = loadStore()
+        store[deviceName] = tuning
+        do {
+            try FileManager.default.createDirectory(
+                at: storeURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+            let encoder = JSONEncoder()
+            encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+            try encoder.encode(store).write(to: storeURL, options: .atomic)
+        } catch {
+            NSLog("Failed to save Zenzai tuning: \(error.localizedDescription)")
+        }
+    }
+}
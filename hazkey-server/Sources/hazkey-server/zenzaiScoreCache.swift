@@ -0,0 +1,146 @@
+import Foundation
+
+private let scoreCacheCapacity = 4096
+private let scoreCacheFormatVersion = 1
+
+/// Remembers how Zenzai ranked the candidates of a conversion.
+///
+/// Entries are keyed by a hash of the left context window, the reading and
+/// the request parameters, and hold the candidates Zenzai put on top. A hit
+/// lets the server skip inference and rerank the dictionary candidates
+/// instead. The cache is dropped whenever the model file or the prompt
+/// settings change, as the stored rankings would no longer be reproduced.
+final class ZenzaiScoreCache {
+    struct RankedCandidate: Codable, Equatable {
+        let text: String
+        let rubyCount: Int
+    }
+
+    private struct Entry: Codable {
+        // empty when the ranking cannot be rebuilt from dictionary candidates
+        var ranked: [RankedCandidate]
+        var lastUsed: UInt64
+    }
+
+    private struct Store: Codable {
+        let version: Int
+        let validityKey: String
+        let entries: [String: Entry]
+    }
+
+    private let storeURL: URL
+    private var validityKey = ""
+    private var entries: [String: Entry] = [:]
+    private var clock: UInt64 = 0
+    private var isDirty = false
+
+    private(set) var hits: UInt64 = 0
+    private(set) var misses: UInt64 = 0
+
+    init(storeURL: URL) {
+        self.storeURL = storeURL
+    }
+
+    /// Drops the entries unless they were made with the same model and prompt settings.
+    /// With `persistent`, entries saved by an earlier run are loaded.
+    func configure(validityKey: String, persistent: Bool) {
+        if persistent && entries.isEmpty {
+            loadStore(validityKey: validityKey)
+        }
+        if validityKey != self.validityKey {
+            self.validityKey = validityKey
+            entries = [:]
+            isDirty = true
+        }
+        if !persistent {
+            try? FileManager.default.removeItem(at: storeURL)
+        }
+    }
+
+    func key(
+        contextWindow: String, reading: String, complete: Bool, inferenceLimit: Int, nBest: Int
+    ) -> String {
+        return "\(fnv1a(contextWindow))|\(complete ? 1 : 0)|\(inferenceLimit)|\(nBest)|\(reading)"
+    }
+
+    /// Returns the stored ranking, or nil when Zenzai has to run.
+    func lookup(_ key: String) -> [RankedCandidate]? {
+        guard var entry = entries[key], !entry.ranked.isEmpty else {
+            misses += 1
+            return nil
+        }
+        hits += 1
+        clock += 1
+        entry.lastUsed = clock
+        entries[key] = entry
+        return entry.ranked
+    }
+
+    func store(_ key: String, ranked: [RankedCandidate]) {
+        if let entry = entries[key], entry.ranked.isEmpty {
+            return
+        }
+        clock += 1
+        entries[key] = Entry(ranked: ranked, lastUsed: clock)
+        isDirty = true
+        if entries.count > scoreCacheCapacity {
+            // evict the least recently used quarter at once
+            let evicted = entries.sorted { $0.value.lastUsed < $1.value.lastUsed }
+                .prefix(scoreCacheCapacity / 4)
+            for (key, _) in evicted {
+                entries.removeValue(forKey: key)
+            }
+        }
+    }
+
+    /// Keeps the key from being cached again, used when a stored ranking
+    /// could not be rebuilt from the dictionary candidates.
+    func markUncacheable(_ key: String) {
+        clock += 1
+        entries[key] = Entry(ranked: [], lastUsed: clock)
+        isDirty = true
+    }
+
+    /// Forgets every entry, including the saved ones, as they hold typed text.
+    func clear() {
+        entries = [:]
+        isDirty = false
+        try? FileManager.default.removeItem(at: storeURL)
+    }
+
+    func save() {
+        guard isDirty else { return }
+        do {
+            try FileManager.default.createDirectory(
+                at: storeURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+            let store = Store(
+                version: scoreCacheFormatVersion, validityKey: validityKey, entries: entries)
+            try JSONEncoder().encode(store).write(to: storeURL, options: .atomic)
+            isDirty = false
+        } catch {
+            NSLog("Failed to save Zenzai score cache: \(error.localizedDescription)")
+        }
+    }
+
+    private func loadStore(validityKey: String) {
+        guard let data = try? Data(contentsOf: storeURL),
+            let store = try? JSONDecoder().decode(Store.self, from: data),
+            store.version == scoreCacheFormatVersion, store.validityKey == validityKey
+        else {
+            return
+        }
+        self.validityKey = validityKey
+        entries = store.entries
+        clock = entries.values.map(\.lastUsed).max() ?? 0
+    }
+
+    // stable across runs, unlike Hasher
+    private func fnv1a(_ text: String) -> String {
+        var hash: UInt64 = 0xcbf2_9ce4_8422_2325
+        for byte in text.utf8 {
+            hash ^= UInt64(byte)
+            hash = hash &* 0x100_0000_01b3
+        }
+        return String(hash, radix: 16)
+    }
+}
@@ -0,0 +1,118 @@
+import Foundation
+
+// The converter creates the llama context without a thread count, and the
+// bundled CPU backend runs its graphs on an OpenMP team. That team is created
+// once when the backend is first used, and reads its size and placement from
+// the OMP_* environment, so the thread settings of the profile are applied
+// through the environment before any backend is loaded. setenv is not safe
+// while other threads run, so this is only done at process startup; a changed
+// setting reaches the next Zenzai worker, which reads the saved profile.
+
+// Cores of one kind differ in rating by a few percent, such as the boost
+// frequencies of preferred cores, while big and little cores differ far more.
+private let hybridRatingGap = 0.8
+
+/// Parses a CPU list such as "0-3,8,10-11".
+func parseCPUList(_ list: String) -> [Int] {
+    var cpus: [Int] = []
+    for part in list.split(separator: ",") {
+        let bounds = part.trimmingCharacters(in: .whitespacesAndNewlines)
+            .split(separator: "-").compactMap { Int($0) }
+        if bounds.count == 1 {
+            cpus.append(bounds[0])
+        } else if bounds.count == 2, bounds[0] <= bounds[1] {
+            cpus.append(contentsOf: bounds[0]...bounds[1])
+        }
+    }
+    return Array(Set(cpus)).sorted()
+}
+
+/// CPUs of the performance cores on a hybrid CPU, nil when all cores are alike.
+func performanceCoreCPUs() -> [Int]? {
+    // Intel hybrid CPUs register the P-cores as their own PMU
+    if let list = try? String(contentsOfFile: "/sys/devices/cpu_core/cpus", encoding: .utf8) {
+        let cpus = parseCPUList(list)
+        if !cpus.isEmpty {
+            return cpus
+        }
+    }
+    // elsewhere the big cores have the highest capacity or maximum frequency
+    let onlineList =
+        (try? String(contentsOfFile: "/sys/devices/system/cpu/online", encoding: .utf8)) ?? ""
+    var ratings: [Int: Int] = [:]
+    for cpu in parseCPUList(onlineList) {
+        let base = "/sys/devices/system/cpu/cpu\(cpu)/"
+        let rating =
+            [base + "cpu_capacity", base + "cpufreq/cpuinfo_max_freq"].lazy.compactMap {
+                (try? String(contentsOfFile: $0, encoding: .utf8)).flatMap {
+                    Int($0.trimmingCharacters(in: .whitespacesAndNewlines))
+                }
+            }.first
+        if let rating = rating, rating > 0 {
+            ratings[cpu] = rating
+        }
+    }
+
+    // the big cores are those above the widest gap between the ratings, when it
+    // is wide enough to separate two clusters
+    let levels = Set(ratings.values).sorted(by: >)
+    var threshold: Int?
+    var widestRatio = hybridRatingGap
+    for (higher, lower) in zip(levels, levels.dropFirst()) {
+        let ratio = Double(lower) / Double(higher)
+        if ratio < widestRatio {
+            widestRatio = ratio
+            threshold = higher
+        }
+    }
+    guard let threshold = threshold else {
+        return nil
+    }
+    return ratings.filter { $0.value >= threshold }.keys.sorted()
+}
+
+/// CPUs Zenzai may run on under the profile, nil for no restriction.
+func zenzaiAllowedCPUs(_ profile: Hazkey_Config_Profile) -> [Int]? {
+    switch profile.zenzaiCpuPolicy {
+    case .zenzaiCpuPerformanceCores:
+        return performanceCoreCPUs()
+    case .zenzaiCpuCustomAffinity:
+        let cpus = parseCPUList(profile.zenzaiCpuAffinity)
+        return cpus.isEmpty ? nil : cpus
+    default:
+        return nil
+    }
+}
+
+/// Sets the OpenMP environment of the CPU backend from the profile.
+/// Takes effect in processes that load the backend afterwards.
+/// HAZKEY_ZENZAI_THREADS overrides the thread count of the profile, which
+/// lets each benchmark process run with a thread count of its own.
+func applyZenzaiThreadEnvironment(_ profile: Hazkey_Config_Profile) {
+    let cpus = zenzaiAllowedCPUs(profile)
+    var threads = Int(profile.zenzaiThreads)
+    if let envThreads = ProcessInfo.processInfo.environment["HAZKEY_ZENZAI_THREADS"]
+        .flatMap({ Int($0) })
+    {
+        threads = envThreads
+    }
+    if threads <= 0, let cpus = cpus {
+        threads = cpus.count
+    }
+
+    if threads > 0 {
+        setenv("OMP_THREAD_LIMIT", "\(threads)", 1)
+    } else {
+        unsetenv("OMP_THREAD_LIMIT")
+    }
+    if let cpus = cpus {
+        // one place per CPU, with the team pinned to them in order
+        setenv("OMP_PLACES", cpus.map { "{\($0)}" }.joined(separator: ","), 1)
+        setenv("OMP_PROC_BIND", "close", 1)
+    } else {
+        unsetenv("OMP_PLACES")
+        unsetenv("OMP_PROC_BIND")
+    }
+    // idle threads sleep instead of spinning on cores the foreground application wants
+    setenv("OMP_WAIT_POLICY", "passive", 1)
+}
@@ -0,0 +1,87 @@
+import Foundation
+import KanaKanjiConverterModule
+
+/// Loads the Zenzai model off the main loop.
+///
+/// The converter maps the weights and builds the graph on its first Zenzai
+/// conversion. A separate converter runs that first conversion on a
+/// background queue and is handed over to the server state once it is done.
+/// `makeConverter` gives that converter on the queue, so that it can be one
+/// that already has the dictionary loaded.
+final class ZenzaiWarmup: @unchecked Sendable {
+    enum Readiness {
+        case disabled
+        case loading
+        case ready
+    }
+
+    private let lock = NSLock()
+    private let queue = DispatchQueue(
+        label: "dev.hiira.hazkey.server.zenzai-warmup", qos: .utility)
+
+    // guarded by lock
+    private var generation = 0
+    private var _readiness: Readiness = .disabled
+    private var _warmupMs: Double = 0
+    private var warmConverter: KanaKanjiConverter?
+
+    var readiness: Readiness {
+        lock.lock()
+        defer { lock.unlock() }
+        return _readiness
+    }
+
+    /// Time the last completed warmup took, in milliseconds.
+    var warmupMs: Double {
+        lock.lock()
+        defer { lock.unlock() }
+        return _warmupMs
+    }
+
+    func start(
+        options: ConvertRequestOptions,
+        makeConverter: @escaping @Sendable () -> KanaKanjiConverter
+    ) {
+        lock.lock()
+        generation += 1
+        let currentGeneration = generation
+        _readiness = .loading
+        warmConverter = nil
+        lock.unlock()
+
+        queue.async { [self] in
+            let start = DispatchTime.now()
+            let converter = makeConverter()
+            var composingText = ComposingText()
+            composingText.insertAtCursorPosition("へんかん", inputStyle: .direct)
+            let _ = converter.requestCandidates(composingText, options: options)
+            let elapsedNs = DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds
+
+            lock.lock()
+            defer { lock.unlock() }
+            // superseded by a newer start() or stop()
+            guard generation == currentGeneration else { return }
+            warmConverter = converter
+            _readiness = .ready
+            _warmupMs = Double(elapsedNs) / 1_000_000
+            NSLog("Zenzai model is ready (warmup took \(Int(_warmupMs)) ms)")
+        }
+    }
+
+    func stop() {
+        lock.lock()
+        defer { lock.unlock() }
+        generation += 1
+        _readiness = .disabled
+        warmConverter = nil
+    }
+
+    /// Returns the warmed-up converter once, after the warmup has finished.
+    func takeWarmConverter() -> KanaKanjiConverter? {
+        lock.lock()
+        defer { lock.unlock() }
+        let converter = warmConverter
+        warmConverter = nil
+        return converter
+    }
+}
@@ -0,0 +1,302 @@
+import Foundation
+import KanaKanjiConverterModule
+import SwiftProtobuf
+
+// Zenzai can run in a hazkey-zenzai-worker child process, which is the same
+// executable started with --zenzai-worker. The server sends length-prefixed
+// WorkerRequest messages to its stdin and reads WorkerResponse messages from
+// fd 3, so a stuck or crashing inference can be killed without losing the
+// server. The responses have a descriptor of their own because llama.cpp and
+// its backends may print to stdout.
+
+private let maxWorkerMessageSize: UInt32 = 1024 * 1024  // 1MB limit
+private let workerResponseFd: Int32 = 3
+private let workerRetryIntervalNs: UInt64 = 5_000_000_000
+
+private func writeMessage(_ message: some SwiftProtobuf.Message, to fd: Int32) throws {
+    let body = try message.serializedData()
+    var length = UInt32(body.count).bigEndian
+    try writeData(to: fd, data: withUnsafeBytes(of: &length) { Data($0) })
+    try writeData(to: fd, data: body)
+}
+
+private func readMessage(from fd: Int32) throws -> Data {
+    let lengthData = try readData(from: fd, count: 4)
+    let length = lengthData.withUnsafeBytes {
+        $0.load(as: UInt32.self).bigEndian
+    }
+    guard length <= maxWorkerMessageSize else {
+        throw SocketError.messageTooLarge(length)
+    }
+    return try readData(from: fd, count: Int(length))
+}
+
+/// Entry point of hazkey-zenzai-worker.
+func runZenzaiWorker(arguments: [String]) -> Int32 {
+    let memoryLimitMb =
+        arguments.first { $0.hasPrefix("--memory-limit-mb=") }
+        .flatMap { Int($0.dropFirst("--memory-limit-mb=".count)) } ?? 0
+    if memoryLimitMb > 0 {
+        let bytes = rlim_t(memoryLimitMb) * 1024 * 1024
+        var limit = rlimit(rlim_cur: bytes, rlim_max: bytes)
+        if setrlimit(__rlimit_resource_t(RLIMIT_AS.rawValue), &limit) != 0 {
+            NSLog("Zenzai worker: failed to set memory limit: \(errno)")
+        }
+    }
+
+    let config = HazkeyServerConfig()
+    // the server applies its time budget and latency target before sending requests
+    config.currentProfile.zenzaiTimeBudgetMs = 0
+    config.currentProfile.zenzaiLatencyTargetMs = 0
+    let converter = KanaKanjiConverter.init(dictionaryURL: config.dictionaryPath)
+    var baseOptions = config.genBaseConvertRequestOptions()
+    baseOptions.learningType = .nothing
+
+    func convert(_ request: Hazkey_Worker_WorkerRequest) -> Hazkey_Worker_WorkerResponse {
+        config.currentProfile.zenzaiInferLimit = request.inferenceLimit
+        var options = baseOptions
+        options.N_best = Int(request.nBest)
+        options.zenzaiMode = config.genZenzaiMode(leftContext: request.leftContext)
+
+        var composingText = ComposingText()
+        composingText.insertAtCursorPosition(request.reading, inputStyle: .direct)
+        if request.complete {
+            composingText.insertAtCursorPosition([
+                ComposingText.InputElement(piece: .compositionSeparator, inputStyle: .direct)
+            ])
+        }
+
+        let converted = converter.requestCandidates(composingText, options: options)
+        return Hazkey_Worker_WorkerResponse.with {
+            $0.candidates = converted.mainResults.prefix(Int(request.nBest)).map { candidate in
+                Hazkey_Worker_WorkerResponse.Candidate.with {
+                    $0.text = candidate.text
+                    $0.rubyCount = Int32(candidate.rubyCount)
+                }
+            }
+        }
+    }
+
+    // load the model before telling the server that the worker is ready
+    let _ = convert(
+        Hazkey_Worker_WorkerRequest.with {
+            $0.reading = "へんかん"
+            $0.complete = true
+            $0.inferenceLimit = config.currentProfile.zenzaiInferLimit
+            $0.nBest = 1
+        })
+
+    do {
+        try writeMessage(
+            Hazkey_Worker_WorkerResponse.with { $0.ready = true }, to: workerResponseFd)
+        while true {
+            let request = try Hazkey_Worker_WorkerRequest(
+                serializedBytes: readMessage(from: STDIN_FILENO))
+            try writeMessage(convert(request), to: workerResponseFd)
+        }
+    } catch SocketError.clientDisconnected {
+        // the server has closed the pipe
+        return 0
+    } catch {
+        NSLog("Zenzai worker: \(error)")
+        return 1
+    }
+}
+
+/// Server side of hazkey-zenzai-worker.
+final class ZenzaiWorkerClient {
+    private enum Reply {
+        case message(Hazkey_Worker_WorkerResponse)
+        case timeout
+        case failed
+    }
+
+    private var pid: pid_t = 0
+    private var requestFd: Int32 = -1
+    private var responseFd: Int32 = -1
+    private var isReady = false
+    private var isEnabled = false
+    private var memoryLimitMb = 0
+    private var retryTime = DispatchTime.now()
+    private var pendingSince: DispatchTime?
+
+    private(set) var restarts: UInt32 = 0
+
+    func start(memoryLimitMb: Int) {
+        stop()
+        self.isEnabled = true
+        self.memoryLimitMb = memoryLimitMb
+        self.retryTime = DispatchTime.now()
+        spawn()
+    }
+
+    func stop() {
+        isEnabled = false
+        terminate()
+    }
+
+    /// Whether the worker has loaded the model. Does not block.
+    func checkReady() -> Bool {
+        guard isEnabled else { return false }
+        if pid <= 0 {
+            guard DispatchTime.now() >= retryTime else { return false }
+            spawn()
+            guard pid > 0 else { return false }
+        }
+        if !isReady {
+            switch readReply(timeoutMs: 0) {
+            case .message(let response):
+                isReady = response.ready
+            case .timeout:
+                break
+            case .failed:
+                fail()
+            }
+        }
+        return isReady
+    }
+
+    /// Sends a request, to be answered by `receive(timeoutMs:)`.
+    func send(_ request: Hazkey_Worker_WorkerRequest) -> Bool {
+        guard checkReady(), pendingSince == nil else { return false }
+        do {
+            try writeMessage(request, to: requestFd)
+            pendingSince = DispatchTime.now()
+            return true
+        } catch {
+            NSLog("Failed to send request to the Zenzai worker: \(error)")
+            fail()
+            return false
+        }
+    }
+
+    /// Waits for the answer to the last request until `timeoutMs` after it was sent.
+    /// The worker is killed when it misses the deadline.
+    func receive(timeoutMs: Int) -> [Hazkey_Worker_WorkerResponse.Candidate]? {
+        guard let sentAt = pendingSince else { return nil }
+        pendingSince = nil
+        let elapsedMs = Int(
+            (DispatchTime.now().uptimeNanoseconds - sentAt.uptimeNanoseconds) / 1_000_000)
+        switch readReply(timeoutMs: max(0, timeoutMs - elapsedMs)) {
+        case .message(let response):
+            return response.candidates
+        case .timeout:
+            NSLog("Zenzai worker missed the \(timeoutMs) ms deadline, killing it")
+            fail()
+            return nil
+        case .failed:
+            fail()
+            return nil
+        }
+    }
+
+    private func readReply(timeoutMs: Int) -> Reply {
+        var pollFd = pollfd(fd: responseFd, events: Int16(POLLIN), revents: 0)
+        let pollRes = poll(&pollFd, 1, Int32(timeoutMs))
+        if pollRes == 0 {
+            return .timeout
+        }
+        guard pollRes > 0, pollFd.revents & Int16(POLLIN) != 0 else {
+            return .failed
+        }
+        do {
+            return .message(
+                try Hazkey_Worker_WorkerResponse(serializedBytes: readMessage(from: responseFd)))
+        } catch {
+            NSLog("Failed to read from the Zenzai worker: \(error)")
+            return .failed
+        }
+    }
+
+    private func spawn() {
+        var toWorker: [Int32] = [-1, -1]
+        var fromWorker: [Int32] = [-1, -1]
+        guard pipe(&toWorker) == 0 else {
+            NSLog("Failed to create pipe for the Zenzai worker")
+            return
+        }
+        guard pipe(&fromWorker) == 0 else {
+            NSLog("Failed to create pipe for the Zenzai worker")
+            close(toWorker[0])
+            close(toWorker[1])
+            return
+        }
+        // only stdio and the response descriptor are inherited, not the server
+        // socket or client connections. An fd that already is fd 3 is replaced
+        // by, or is, the response descriptor
+        let openFds = (try? FileManager.default.contentsOfDirectory(atPath: "/proc/self/fd"))?
+            .compactMap { Int32($0) } ?? []
+        for fd in Set(openFds + toWorker + fromWorker)
+        where fd > STDERR_FILENO && fd != workerResponseFd {
+            let _ = fcntl(fd, F_SETFD, FD_CLOEXEC)
+        }
+
+        var actions = posix_spawn_file_actions_t()
+        posix_spawn_file_actions_init(&actions)
+        defer { posix_spawn_file_actions_destroy(&actions) }
+        posix_spawn_file_actions_adddup2(&actions, toWorker[0], STDIN_FILENO)
+        posix_spawn_file_actions_adddup2(&actions, fromWorker[1], workerResponseFd)
+
+        let arguments = [
+            "hazkey-zenzai-worker", "--zenzai-worker", "--memory-limit-mb=\(memoryLimitMb)",
+        ]
+        var argv: [UnsafeMutablePointer<CChar>?] = arguments.map { strdup($0) } + [nil]
+        defer { argv.forEach { free($0) } }
+
+        var newPid: pid_t = 0
+        let spawnRes = posix_spawn(&newPid, "/proc/self/exe", &actions, nil, &argv, environ)
+        close(toWorker[0])
+        close(fromWorker[1])
+        guard spawnRes == 0 else {
+            NSLog("Failed to start the Zenzai worker: \(spawnRes)")
+            close(toWorker[1])
+            close(fromWorker[0])
+            retryTime = DispatchTime.now() + .nanoseconds(Int(workerRetryIntervalNs))
+            return
+        }
+
+        NSLog("Started Zenzai worker: \(newPid)")
+        pid = newPid
+        requestFd = toWorker[1]
+        responseFd = fromWorker[0]
+        isReady = false
+        pendingSince = nil
+    }
+
+    private func terminate() {
+        guard pid > 0 else { return }
+        kill(pid, SIGKILL)
+        var status: Int32 = 0
+        waitpid(pid, &status, 0)
+        close(requestFd)
+        close(responseFd)
+        pid = 0
+        requestFd = -1
+        responseFd = -1
+        isReady = false
+        pendingSince = nil
+    }
+
+    /// Kills the worker. A new one is started after a short delay.
+    private func fail() {
+        terminate()
+        restarts += 1
+        retryTime = DispatchTime.now() + .nanoseconds(Int(workerRetryIntervalNs))
+    }
+}
+
+/// Moves the candidates chosen by Zenzai to the front, in its order.
+func rerankCandidates(
+    _ candidates: [Candidate], by ranked: [(text: String, rubyCount: Int)]
+) -> [Candidate] {
+    var remaining = candidates
+    var reranked: [Candidate] = []
+    for rankedCandidate in ranked {
+        if let index = remaining.firstIndex(where: {
+            $0.text == rankedCandidate.text && $0.rubyCount == rankedCandidate.rubyCount
+        }) {
+            reranked.append(remaining.remove(at: index))
+        }
+    }
+    return reranked + remaining
+}
@@ -0,0 +1,108 @@
+import Foundation
+import KanaKanjiConverterModule
+import XCTest
+
+@testable import hazkey_server
+
+// Built-in layouts and what is typed with them
+private let keymapLayouts: [(name: String, keymap: Keymap, table: InputTable, keys: String)] = [
+  ("Romaji", [:], romajiTable, "kyouhaiitenkidesunexashitahaamegafurusoudesu"),
+  ("Kana", [:], kanaTable, "きょうはいいてんきですね、あしたはあめがふるそうです"),
+  ("JIS Kana", JISKanaMap, kanaTable, "qwertyuiop@[asdfghjkl;:]zxcvbnm,./1234567890-^"),
+]
+private let keymapIterations = 200
+
+final class CompiledKeymapTests: XCTestCase {
+
+  private func register(_ table: InputTable) -> String {
+    let tableName = UUID().uuidString
+    InputStyleManager.registerInputStyle(
+      table: InputTable(tables: [compositionSeparatorTable, table], order: .lastInputWins),
+      for: tableName)
+    return tableName
+  }
+
+  // the compiled elements must read the same as those looked up in the keymap
+  func testMatchesKeymapLookup() {
+    for layout in keymapLayouts {
+      let tableName = register(layout.table)
+      let compiled = CompiledKeymap(keymap: layout.keymap, tableName: tableName)
+      var compiledText = ComposingText()
+      var lookedUpText = ComposingText()
+      for key in layout.keys {
+        compiledText.insertAtCursorPosition([compiled.inputElement(for: key)])
+        lookedUpText.insertAtCursorPosition([
+          CompiledKeymap.lookUp(key, keymap: layout.keymap, tableName: tableName)
+        ])
+      }
+      XCTAssertEqual(compiledText.convertTarget, lookedUpText.convertTarget, layout.name)
+      XCTAssertEqual(compiledText.input.count, layout.keys.count, layout.name)
+    }
+  }
+
+  func testJISKanaKeysTypeKana() {
+    let compiled = CompiledKeymap(keymap: JISKanaMap, tableName: register(kanaTable))
+    var text = ComposingText()
+    for key in "3e" {
+      text.insertAtCursorPosition([compiled.inputElement(for: key)])
+    }
+    XCTAssertEqual(text.convertTarget, "あい")
+  }
+
+  func testUnmappedKeyIsCharacter() {
+    let compiled = CompiledKeymap(keymap: JISKanaMap, tableName: register(kanaTable))
+    for key: Character in ["あ", "\u{7F}", "é"] {
+      guard case .character(let character) = compiled.inputElement(for: key).piece else {
+        XCTFail("\(key) is not a character")
+        continue
+      }
+      XCTAssertEqual(character, key)
+    }
+  }
+
+  // what a keystroke takes to become an input element without the compiled keymap
+  func testKeymapLookupPerformance() {
+    let layouts = keymapLayouts.map { ($0.keymap, register($0.table), Array($0.keys)) }
+    measure {
+      for (keymap, tableName, keys) in layouts {
+        for _ in 0..<keymapIterations {
+          for key in keys {
+            let _ = CompiledKeymap.lookUp(key, keymap: keymap, tableName: tableName)
+          }
+        }
+      }
+    }
+  }
+
+  func testCompiledKeymapPerformance() {
+    let layouts = keymapLayouts.map {
+      (CompiledKeymap(keymap: $0.keymap, tableName: register($0.table)), Array($0.keys))
+    }
+    measure {
+      for (compiled, keys) in layouts {
+        for _ in 0..<keymapIterations {
+          for key in keys {
+            let _ = compiled.inputElement(for: key)
+          }
+        }
+      }
+    }
+  }
+
+  // the composing text is rebuilt a key at a time, as it is while typing
+  func testInputTablePerformance() {
+    let layouts = keymapLayouts.map {
+      (CompiledKeymap(keymap: $0.keymap, tableName: register($0.table)), Array($0.keys))
+    }
+    measure {
+      for (compiled, keys) in layouts {
+        for _ in 0..<keymapIterations / 10 {
+          var text = ComposingText()
+          for key in keys {
+            text.insertAtCursorPosition([compiled.inputElement(for: key)])
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,75 @@
+import Foundation
+import XCTest
+
+@testable import hazkey_server
+
+final class EnglishLexiconTests: XCTestCase {
+  private var directory: URL!
+
+  override func setUpWithError() throws {
+    try super.setUpWithError()
+    directory = FileManager.default.temporaryDirectory.appendingPathComponent(
+      UUID().uuidString, isDirectory: true)
+    try FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+  }
+
+  override func tearDownWithError() throws {
+    try? FileManager.default.removeItem(at: directory)
+    try super.tearDownWithError()
+  }
+
+  // builds a lexicon from "word<TAB>frequency" lines as --build-english-lexicon does
+  private func build(_ lines: [String]) throws -> URL {
+    let list = directory.appendingPathComponent("words.txt")
+    let output = directory.appendingPathComponent("english.lexicon")
+    try lines.joined(separator: "\n").write(to: list, atomically: true, encoding: .utf8)
+    XCTAssertEqual(
+      buildEnglishLexicon(arguments: ["--build-english-lexicon", list.path, output.path]), 0)
+    return output
+  }
+
+  func testPredictionsByFrequency() throws {
+    let lexicon = try XCTUnwrap(
+      EnglishLexicon(url: build(["hello\t50", "help\t80", "hell\t10", "world\t90", "he\t99"])))
+    XCTAssertEqual(lexicon.predictions(prefix: "he", limit: 5), ["help", "hello", "hell"])
+    XCTAssertEqual(lexicon.predictions(prefix: "hel", limit: 2), ["help", "hello"])
+    XCTAssertEqual(lexicon.predictions(prefix: "x", limit: 5), [])
+  }
+
+  func testPrefixIgnoresCase() throws {
+    let lexicon = try XCTUnwrap(EnglishLexicon(url: build(["Linux\t10", "line\t5"])))
+    XCTAssertEqual(lexicon.predictions(prefix: "LI", limit: 5), ["Linux", "line"])
+  }
+
+  // prefixes of more than 4096 words are looked up in the top word records
+  func testTopWordsOfShortPrefix() throws {
+    var lines = (0..<5000).map { "s\(String($0, radix: 26))\t\($0)" }
+    lines.append("sun\t100000")
+    lines.append("moon\t100000")
+    let lexicon = try XCTUnwrap(EnglishLexicon(url: build(lines)))
+
+    XCTAssertEqual(
+      lexicon.predictions(prefix: "s", limit: 3),
+      ["sun", "s" + String(4999, radix: 26), "s" + String(4998, radix: 26)])
+    XCTAssertEqual(lexicon.predictions(prefix: "S", limit: 1), ["sun"])
+    XCTAssertEqual(lexicon.predictions(prefix: "m", limit: 3), ["moon"])
+  }
+
+  func testRejectsOtherFiles() throws {
+    let file = directory.appendingPathComponent("other")
+    try Data("HZEL".utf8).write(to: file)
+    XCTAssertNil(EnglishLexicon(url: file))
+    try Data(repeating: 0, count: 64).write(to: file)
+    XCTAssertNil(EnglishLexicon(url: file))
+    XCTAssertNil(EnglishLexicon(url: directory.appendingPathComponent("missing")))
+  }
+
+  func testRejectsWordsOutsideTheFile() throws {
+    let url = try build(["hello\t50", "help\t80"])
+    var data = try Data(contentsOf: url)
+    // the length of the first word
+    data.replaceSubrange(20..<24, with: [0xFF, 0xFF, 0, 0])
+    try data.write(to: url)
+    XCTAssertNil(EnglishLexicon(url: url))
+  }
+}
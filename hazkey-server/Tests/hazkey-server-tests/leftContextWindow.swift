@@ -0,0 +1,56 @@
+import XCTest
+
+@testable import hazkey_server
+
+final class LeftContextWindowTests: XCTestCase {
+
+  func testKeepsShortContext() {
+    var window = LeftContextWindow(tokenLimit: 8)
+    XCTAssertTrue(window.update("今日は"))
+    XCTAssertEqual(window.text, "今日は")
+    XCTAssertFalse(window.update("今日は"))
+  }
+
+  func testCutsToThreeQuartersOfTheLimit() {
+    var window = LeftContextWindow(tokenLimit: 8)
+    XCTAssertTrue(window.update("あいうえおかきくけ"))
+    XCTAssertEqual(window.text, "えおかきくけ")
+  }
+
+  func testAsciiRunsAreTokensOfUpToFourLetters() {
+    var window = LeftContextWindow(tokenLimit: 4)
+    // "abcd", "efgh", "i", "." and "jk": five tokens, cut to three
+    XCTAssertTrue(window.update("abcdefghi.jk"))
+    XCTAssertEqual(window.text, "i.jk")
+  }
+
+  func testAppendedTextKeepsTheStart() {
+    var window = LeftContextWindow(tokenLimit: 8)
+    let _ = window.update("あいうえおかきくけ")
+    XCTAssertTrue(window.update("あいうえおかきくけこ"))
+    XCTAssertEqual(window.text, "えおかきくけこ")
+  }
+
+  func testContextCutByTheClientKeepsTheStart() {
+    var window = LeftContextWindow(tokenLimit: 8)
+    let _ = window.update("あいうえおかきくけ")
+    let _ = window.update("あいうえおかきくけこ")
+    XCTAssertTrue(window.update("うえおかきくけこさ"))
+    XCTAssertEqual(window.text, "えおかきくけこさ")
+  }
+
+  func testOtherContextReplacesTheWindow() {
+    var window = LeftContextWindow(tokenLimit: 8)
+    let _ = window.update("あいうえお")
+    XCTAssertTrue(window.update("別の文"))
+    XCTAssertEqual(window.text, "別の文")
+  }
+
+  func testReset() {
+    var window = LeftContextWindow(tokenLimit: 8)
+    let _ = window.update("今日は")
+    window.reset()
+    XCTAssertEqual(window.text, "")
+    XCTAssertTrue(window.update("今日は"))
+  }
+}
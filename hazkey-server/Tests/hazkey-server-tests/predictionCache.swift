@@ -0,0 +1,98 @@
+import KanaKanjiConverterModule
+import XCTest
+
+@testable import hazkey_server
+
+final class PredictionCacheTests: XCTestCase {
+
+  // readings of dictionary entries are katakana
+  private func candidate(_ text: String, ruby: String) -> Candidate {
+    return Candidate(
+      text: text, value: -10, composingCount: .inputCount(1), lastMid: MIDData.一般.mid,
+      data: [
+        DicdataElement(
+          word: text, ruby: ruby, cid: CIDData.一般名詞.cid, mid: MIDData.一般.mid, value: -10)
+      ])
+  }
+
+  private func inputCount(_ candidate: Candidate) -> Int? {
+    if case .inputCount(let count) = candidate.composingCount {
+      return count
+    }
+    return nil
+  }
+
+  func testFiltersCompleteLookup() {
+    var cache = PredictionCache()
+    cache.store(
+      reading: "か",
+      candidates: [candidate("会社", ruby: "カイシャ"), candidate("会議", ruby: "カイギ")],
+      shownCount: 5)
+
+    let predictions = cache.candidates(for: "かい", inputCount: 4)
+    XCTAssertEqual(predictions?.map { $0.text }, ["会社", "会議"])
+    XCTAssertEqual(predictions?.first.flatMap(inputCount), 4)
+  }
+
+  // the list on screen would shrink, so the converter is asked for more
+  func testFewerPredictionsThanShownNeedFullLookup() {
+    var cache = PredictionCache()
+    cache.store(
+      reading: "か",
+      candidates: [candidate("会社", ruby: "カイシャ"), candidate("傘", ruby: "カサ")],
+      shownCount: 5)
+
+    XCTAssertNil(cache.candidates(for: "かい", inputCount: 4))
+    XCTAssertNil(cache.candidates(for: "かき", inputCount: 4))
+  }
+
+  // "きょうk" matches no reading until the romaji becomes kana
+  func testTrailingRomajiKeepsTheKanaReading() {
+    var cache = PredictionCache()
+    cache.store(
+      reading: "きょう",
+      candidates: [candidate("今日か", ruby: "キョウカ"), candidate("強化", ruby: "キョウカ")],
+      shownCount: 5)
+    XCTAssertNil(cache.candidates(for: "きょうk", inputCount: 6))
+    cache.store(reading: "きょうk", candidates: [], shownCount: 5)
+
+    XCTAssertEqual(
+      cache.candidates(for: "きょうか", inputCount: 7)?.map { $0.text }, ["今日か", "強化"])
+  }
+
+  func testTruncatedLookupNeedsFullLookup() {
+    var cache = PredictionCache()
+    cache.store(
+      reading: "か",
+      candidates: [candidate("会社", ruby: "カイシャ"), candidate("傘", ruby: "カサ")],
+      shownCount: 2)
+
+    XCTAssertNil(cache.candidates(for: "かい", inputCount: 4))
+  }
+
+  // "n" and "nn" both read "ん", with a different number of input elements
+  func testSameReadingUpdatesInputCount() {
+    var cache = PredictionCache()
+    cache.store(reading: "かん", candidates: [candidate("漢字", ruby: "カンジ")], shownCount: 1)
+
+    let predictions = cache.candidates(for: "かん", inputCount: 4)
+    XCTAssertEqual(predictions?.map { $0.text }, ["漢字"])
+    XCTAssertEqual(predictions?.first.flatMap(inputCount), 4)
+  }
+
+  func testOtherReadingNeedsFullLookup() {
+    var cache = PredictionCache()
+    cache.store(reading: "かい", candidates: [candidate("会社", ruby: "カイシャ")], shownCount: 5)
+
+    XCTAssertNil(cache.candidates(for: "か", inputCount: 2))
+    XCTAssertNil(cache.candidates(for: "さ", inputCount: 2))
+  }
+
+  func testReset() {
+    var cache = PredictionCache()
+    cache.store(reading: "か", candidates: [candidate("傘", ruby: "カサ")], shownCount: 5)
+    cache.reset()
+
+    XCTAssertNil(cache.candidates(for: "かさ", inputCount: 4))
+  }
+}
@@ -0,0 +1,73 @@
+import XCTest
+
+@testable import hazkey_server
+
+final class ReconversionIndexTests: XCTestCase {
+
+  func testReadingOfCommittedClause() {
+    var index = ReconversionIndex()
+    index.record(text: "今日", reading: "きょう")
+    XCTAssertEqual(index.reading(for: "今日"), "きょう")
+  }
+
+  func testReadingSpansClausesAndKana() {
+    var index = ReconversionIndex()
+    index.record(text: "今日", reading: "きょう")
+    index.record(text: "天気", reading: "てんき")
+    XCTAssertEqual(index.reading(for: "今日は天気ですネ"), "きょうはてんきですね")
+  }
+
+  func testLongestClauseIsPreferred() {
+    var index = ReconversionIndex()
+    index.record(text: "日", reading: "ひ")
+    index.record(text: "今日", reading: "こんにち")
+    index.record(text: "今", reading: "いま")
+    XCTAssertEqual(index.reading(for: "今日"), "こんにち")
+    XCTAssertEqual(index.reading(for: "日今"), "ひいま")
+  }
+
+  func testUnknownTextHasNoReading() {
+    var index = ReconversionIndex()
+    index.record(text: "今日", reading: "きょう")
+    XCTAssertNil(index.reading(for: "明日"))
+    XCTAssertNil(index.reading(for: "今日はabc"))
+    XCTAssertNil(index.reading(for: ""))
+  }
+
+  func testLongSelectionIsNotLookedUp() {
+    var index = ReconversionIndex()
+    let text = String(repeating: "あ", count: 65)
+    index.record(text: text, reading: text)
+    XCTAssertNil(index.reading(for: text))
+  }
+
+  func testRecordingAgainReplacesReading() {
+    var index = ReconversionIndex()
+    index.record(text: "今日", reading: "きょう")
+    index.record(text: "今日", reading: "こんにち")
+    XCTAssertEqual(index.reading(for: "今日"), "こんにち")
+  }
+
+  func testLeastRecentlyCommittedIsEvicted() {
+    var index = ReconversionIndex()
+    index.record(text: "最初", reading: "さいしょ")
+    index.record(text: "次", reading: "つぎ")
+    for number in 0..<RECONVERSION_INDEX_CAPACITY - 2 {
+      index.record(text: "語\(number)", reading: "ご")
+    }
+    // committing it again makes it the most recent
+    index.record(text: "最初", reading: "さいしょ")
+    index.record(text: "後", reading: "あと")
+
+    XCTAssertEqual(index.reading(for: "最初"), "さいしょ")
+    XCTAssertNil(index.reading(for: "次"))
+    XCTAssertEqual(index.reading(for: "後"), "あと")
+  }
+
+  func testRemoveAll() {
+    var index = ReconversionIndex()
+    index.record(text: "今日", reading: "きょう")
+    index.removeAll()
+    XCTAssertNil(index.reading(for: "今日"))
+  }
+}
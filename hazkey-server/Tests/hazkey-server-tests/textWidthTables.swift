@@ -0,0 +1,81 @@
+import Foundation
+import XCTest
+
+@testable import hazkey_server
+
+// Readings and romaji the tables are checked and timed with
+private let textConvertInputs = [
+  "へんかん", "きょうはいいてんきですね", "ぱーてぃーにしょうたいされた",
+  "ゔぁいおりんとびーる", "こんぴゅーた、「だいがく」。", "ｗｗｗ．ｅｘａｍｐｌｅ．ｃｏｍ",
+  "hazkey", "Romaji Input 123",
+]
+private let textConvertIterations = 2000
+
+final class TextWidthTablesTests: XCTestCase {
+
+  func testKatakana() {
+    XCTAssertEqual(TextWidthTables.katakana("きょうはゔぁいおりん"), "キョウハヴァイオリン")
+    XCTAssertEqual(TextWidthTables.katakana("ゝゞー、abc"), "ヽヾー、abc")
+  }
+
+  func testHiraganaReversesKatakana() {
+    XCTAssertEqual(TextWidthTables.hiragana("カタカナヴァ"), "かたかなゔぁ")
+    XCTAssertEqual(TextWidthTables.hiragana("ヽヾー漢字"), "ゝゞー漢字")
+  }
+
+  func testHalfwidthKatakanaDecomposesSoundMarks() {
+    XCTAssertEqual(TextWidthTables.halfwidth("ガパヴー"), "ｶﾞﾊﾟｳﾞｰ")
+    XCTAssertEqual(TextWidthTables.halfwidth("「テスト」、。・"), "｢ﾃｽﾄ｣､｡･")
+  }
+
+  func testHalfwidthAlphabet() {
+    XCTAssertEqual(TextWidthTables.halfwidth("ｗｗｗ．ｅｘ　１２３"), "www.ex 123")
+    XCTAssertEqual(TextWidthTables.halfwidth("漢字"), "漢字")
+  }
+
+  func testFullwidthAlphabet() {
+    XCTAssertEqual(TextWidthTables.fullwidth("Hazkey 1!~"), "Ｈａｚｋｅｙ　１！～")
+    XCTAssertEqual(TextWidthTables.fullwidth("かな"), "かな")
+  }
+
+  // the tables replace these transforms, so they must give the same results
+  func testMatchesICUTransforms() {
+    for input in textConvertInputs {
+      let katakana = input.applyingTransform(.hiraganaToKatakana, reverse: false) ?? input
+      XCTAssertEqual(TextWidthTables.katakana(input), katakana, input)
+      XCTAssertEqual(
+        TextWidthTables.halfwidth(TextWidthTables.katakana(input)),
+        katakana.applyingTransform(.fullwidthToHalfwidth, reverse: false) ?? katakana, input)
+      XCTAssertEqual(
+        TextWidthTables.fullwidth(input),
+        input.applyingTransform(.fullwidthToHalfwidth, reverse: true), input)
+      XCTAssertEqual(
+        TextWidthTables.halfwidth(input),
+        input.applyingTransform(.fullwidthToHalfwidth, reverse: false), input)
+    }
+  }
+
+  func testTablePerformance() {
+    measure {
+      for _ in 0..<textConvertIterations {
+        for input in textConvertInputs {
+          let _ = TextWidthTables.halfwidth(TextWidthTables.katakana(input))
+          let _ = TextWidthTables.fullwidth(input)
+        }
+      }
+    }
+  }
+
+  // the transforms the tables replaced, to compare with testTablePerformance
+  func testICUTransformPerformance() {
+    measure {
+      for _ in 0..<textConvertIterations {
+        for input in textConvertInputs {
+          let katakana = input.applyingTransform(.hiraganaToKatakana, reverse: false) ?? input
+          let _ = katakana.applyingTransform(.fullwidthToHalfwidth, reverse: false)
+          let _ = input.applyingTransform(.fullwidthToHalfwidth, reverse: true)
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,115 @@
+import Foundation
+import KanaKanjiConverterModule
+import XCTest
+
+@testable import hazkey_server
+
+// Mistyped romaji the corrections are checked and timed with
+private let typoInputs = [
+  "henkqn", "kyouhq", "kaignio", "shiryouqo", "okurimssu", "ashitq", "yotwiwo", "kakunjn",
+  "shinkanswnno", "kippuwp",
+]
+
+final class TypoCorrectorTests: XCTestCase {
+  private static let tableName: String = {
+    let tableName = UUID().uuidString
+    InputStyleManager.registerInputStyle(
+      table: InputTable(tables: [compositionSeparatorTable, romajiTable], order: .lastInputWins),
+      for: tableName)
+    return tableName
+  }()
+
+  // the keys read through the keymap with the romaji table, as getCandidates reads them
+  private func reading(_ keys: [Character], keymap: Keymap = [:]) -> ComposingText {
+    let compiled = CompiledKeymap(keymap: keymap, tableName: Self.tableName)
+    var text = ComposingText()
+    text.insertAtCursorPosition(
+      keys.map(compiled.inputElement)
+        + [
+          ComposingText.InputElement(
+            piece: .compositionSeparator, inputStyle: .mapped(id: .tableName(Self.tableName)))
+        ])
+    return text
+  }
+
+  private func corrections(
+    of input: String, keymap: Keymap = [:], limit: Int = TYPO_CORRECTION_MAX_READINGS,
+    deadline: DispatchTime = .distantFuture
+  ) -> [String] {
+    return TypoCorrector(keymap: keymap).corrections(
+      of: Array(input), limit: limit, deadline: deadline
+    ) { unconvertedLetters(reading($0, keymap: keymap).convertTarget) }.map { String($0) }
+  }
+
+  func testUnconvertedLetters() {
+    XCTAssertEqual(unconvertedLetters("へんkqん"), ["k", "q"])
+    XCTAssertEqual(unconvertedLetters("へんかん、1"), [])
+  }
+
+  func testSubstitutesAdjacentKey() {
+    let corrected = corrections(of: "henkqn")
+    XCTAssertTrue(corrected.contains("henkan"), "\(corrected)")
+    XCTAssertLessThanOrEqual(corrected.count, TYPO_CORRECTION_MAX_READINGS)
+  }
+
+  func testCorrectionsConvertFully() {
+    for input in typoInputs {
+      for corrected in corrections(of: input) {
+        XCTAssertEqual(unconvertedLetters(reading(Array(corrected)).convertTarget), [], input)
+      }
+    }
+  }
+
+  // the edits are made on physical keys, which the keymap turns into what they type
+  func testNeighborsAreKeyedByPhysicalKey() {
+    // the key below "1" is "q", which types "a" with this keymap
+    let keymap: Keymap = ["q": ("a", nil)]
+    let corrected = corrections(of: "henk1n", keymap: keymap, limit: 100)
+    XCTAssertTrue(corrected.contains("henkqn"), "\(corrected)")
+    XCTAssertFalse(corrected.contains("henkan"), "\(corrected)")
+  }
+
+  func testStopsAtDeadline() {
+    XCTAssertEqual(corrections(of: "henkqn", deadline: .now()), [])
+  }
+
+  func testCorrectionPerformance() {
+    let corrector = TypoCorrector(keymap: [:])
+    measure {
+      for input in typoInputs {
+        let deadline = DispatchTime.now() + .milliseconds(TYPO_CORRECTION_BUDGET_MS)
+        let _ = corrector.corrections(
+          of: Array(input), limit: TYPO_CORRECTION_MAX_READINGS, deadline: deadline
+        ) { unconvertedLetters(reading($0).convertTarget) }
+      }
+    }
+  }
+
+  // what getCandidates adds on top of the plain conversion, which needs the dictionary
+  func testCorrectionWithConversionsPerformance() throws {
+    let config = HazkeyServerConfig()
+    try XCTSkipUnless(
+      FileManager.default.fileExists(atPath: config.dictionaryPath.path),
+      "Dictionary not found: \(config.dictionaryPath.path)")
+    let converter = KanaKanjiConverter.init(dictionaryURL: config.dictionaryPath)
+    var options = config.genBaseConvertRequestOptions()
+    options.learningType = .nothing
+    options.zenzaiMode = .off
+    options.requireJapanesePrediction = .disabled
+    let corrector = TypoCorrector(keymap: [:])
+
+    // the first conversion loads the dictionary
+    let _ = converter.requestCandidates(reading(Array("a")), options: options)
+    measure {
+      for input in typoInputs {
+        let deadline = DispatchTime.now() + .milliseconds(TYPO_CORRECTION_BUDGET_MS)
+        let corrected = corrector.corrections(
+          of: Array(input), limit: TYPO_CORRECTION_MAX_READINGS, deadline: deadline
+        ) { unconvertedLetters(reading($0).convertTarget) }
+        for keys in corrected where DispatchTime.now() < deadline {
+          let _ = converter.requestCandidates(reading(keys), options: options)
+        }
+      }
+    }
+  }
+}
@@ -146,11 +146,52 @@ struct SuggestionListMode {
     }
 };
 
+struct ZenzaiCpuPolicy {
+    static constexpr int DEFAULT_INDEX = 0;  // ZENZAI_CPU_ALL_CORES
+    using EnumType = hazkey::config::Profile_ZenzaiCpuPolicy;
+    static constexpr EnumType DEFAULT_ENUM =
+        hazkey::config::Profile_ZenzaiCpuPolicy_ZENZAI_CPU_ALL_CORES;
+
+    static void setFromEnum(QComboBox* combo, int enumValue) {
+        SET_COMBO(
+            combo, enumValue, DEFAULT_INDEX,
+            ENUM_CASE(
+                hazkey::config::Profile_ZenzaiCpuPolicy_ZENZAI_CPU_ALL_CORES, 0)
+                ENUM_CASE(
+                    hazkey::config::
+                        Profile_ZenzaiCpuPolicy_ZENZAI_CPU_PERFORMANCE_CORES,
+                    1)
+                    ENUM_CASE(
+                        hazkey::config::
+                            Profile_ZenzaiCpuPolicy_ZENZAI_CPU_CUSTOM_AFFINITY,
+                        2));
+    }
+
+    static EnumType getEnum(QComboBox* combo) {
+        return GET_COMBO_ENUM(
+            combo, EnumType, DEFAULT_ENUM,
+            INDEX_CASE(
+                0, hazkey::config::Profile_ZenzaiCpuPolicy_ZENZAI_CPU_ALL_CORES)
+                INDEX_CASE(
+                    1,
+                    hazkey::config::
+                        Profile_ZenzaiCpuPolicy_ZENZAI_CPU_PERFORMANCE_CORES)
+                    INDEX_CASE(
+                        2,
+                        hazkey::config::
+                            Profile_ZenzaiCpuPolicy_ZENZAI_CPU_CUSTOM_AFFINITY));
+    }
+};
+
 struct CheckboxDefaults {
     static constexpr bool USE_HISTORY = false;
     static constexpr bool STOP_STORE_NEW_HISTORY = false;
+    static constexpr bool USE_ENGLISH_PREDICTION = false;
     static constexpr bool ENABLE_ZENZAI = false;
     static constexpr bool ZENZAI_CONTEXTUAL = false;
+    static constexpr bool ZENZAI_ISOLATED_WORKER = false;
+    static constexpr bool ZENZAI_USE_DRAFT_MODEL = false;
+    static constexpr bool ZENZAI_PERSIST_SCORE_CACHE = false;
     static constexpr bool HALFWIDTH_KATAKANA = false;
     static constexpr bool EXTENDED_EMOJI = false;
     static constexpr bool COMMA_SEPARATED_NUMBER = false;
@@ -160,12 +201,17 @@ struct CheckboxDefaults {
     static constexpr bool UNICODE_CODEPOINT = false;
     static constexpr bool ROMAN_TYPOGRAPHY = false;
     static constexpr bool HAZKEY_VERSION = false;
+    static constexpr bool TYPO_CORRECTION = false;
 };
 
 struct SpinboxDefaults {
     static constexpr int NUM_SUGGESTIONS = 5;
     static constexpr int NUM_CANDIDATES_PER_PAGE = 10;
     static constexpr int ZENZAI_INFERENCE_LIMIT = 100;
+    static constexpr int ZENZAI_TIME_BUDGET_MS = 0;
+    static constexpr int ZENZAI_LATENCY_TARGET_MS = 0;
+    static constexpr int ZENZAI_IDLE_UNLOAD_MINUTES = 30;
+    static constexpr int ZENZAI_THREADS = 0;
 };
 }  // namespace ConfigDefs
 
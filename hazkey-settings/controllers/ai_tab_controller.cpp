@@ -11,9 +11,14 @@
 #include <QNetworkReply>
 #include <QNetworkRequest>
 #include <QProgressDialog>
+#include <QPushButton>
 #include <QSignalBlocker>
+#include <QStringList>
+#include <QTimer>
 #include <QUrl>
+#include <optional>
 
+#include "config_definitions.h"
 #include "config_macros.h"
 #include "controllers/warning_widget_factory.h"
 #include "ui_mainwindow.h"
@@ -23,6 +28,7 @@ namespace hazkey::settings {
 namespace {
 constexpr char kZenzaiExpectedChecksum[] =
     "4de930c06bef8c263aa1aa40684af206db4ce1b96375b3b8ed0ea508e0b14f6c";
+constexpr int kBenchmarkPollIntervalMs = 1000;
 }  // namespace
 
 AiTabController::AiTabController(Ui::MainWindow* ui, QWidget* window,
@@ -35,7 +41,10 @@ AiTabController::AiTabController(Ui::MainWindow* ui, QWidget* window,
       networkManager_(networkManager),
       currentDownload_(nullptr),
       downloadProgressDialog_(nullptr),
-      isLoading_(false) {}
+      benchmarkTimer_(new QTimer(this)),
+      isLoading_(false) {
+    benchmarkTimer_->setInterval(kBenchmarkPollIntervalMs);
+}
 
 void AiTabController::setContext(const TabContext& context) {
     context_ = context;
@@ -49,6 +58,12 @@ void AiTabController::connectSignals() {
                 }
                 saveToConfig();
             });
+    connect(ui_->zenzaiCpuPolicy, &QComboBox::currentIndexChanged, this,
+            [this](int) { updateCpuAffinityEnabled(); });
+    connect(ui_->zenzaiBenchmarkButton, &QPushButton::clicked, this,
+            &AiTabController::onRunBenchmark);
+    connect(benchmarkTimer_, &QTimer::timeout, this,
+            &AiTabController::onPollBenchmark);
 }
 
 void AiTabController::loadFromConfig() {
@@ -64,11 +79,39 @@ void AiTabController::loadFromConfig() {
     SET_SPINBOX(ui_->zenzaiInferenceLimit,
                 context_.currentProfile->zenzai_infer_limit(),
                 ConfigDefs::SpinboxDefaults::ZENZAI_INFERENCE_LIMIT);
+    SET_SPINBOX(ui_->zenzaiTimeBudget,
+                context_.currentProfile->zenzai_time_budget_ms(),
+                ConfigDefs::SpinboxDefaults::ZENZAI_TIME_BUDGET_MS);
+    SET_SPINBOX(ui_->zenzaiLatencyTarget,
+                context_.currentProfile->zenzai_latency_target_ms(),
+                ConfigDefs::SpinboxDefaults::ZENZAI_LATENCY_TARGET_MS);
+    SET_SPINBOX(ui_->zenzaiIdleUnloadMinutes,
+                context_.currentProfile->has_zenzai_idle_unload_minutes()
+                    ? context_.currentProfile->zenzai_idle_unload_minutes()
+                    : ConfigDefs::SpinboxDefaults::ZENZAI_IDLE_UNLOAD_MINUTES,
+                ConfigDefs::SpinboxDefaults::ZENZAI_IDLE_UNLOAD_MINUTES);
     SET_CHECKBOX(ui_->enableZenzai, context_.currentProfile->zenzai_enable(),
                  ConfigDefs::CheckboxDefaults::ENABLE_ZENZAI);
     SET_CHECKBOX(ui_->zenzaiContextualConversion,
                  context_.currentProfile->zenzai_contextual_mode(),
                  ConfigDefs::CheckboxDefaults::ZENZAI_CONTEXTUAL);
+    SET_CHECKBOX(ui_->zenzaiIsolatedWorker,
+                 context_.currentProfile->zenzai_isolated_worker(),
+                 ConfigDefs::CheckboxDefaults::ZENZAI_ISOLATED_WORKER);
+    SET_CHECKBOX(ui_->zenzaiUseDraftModel,
+                 context_.currentProfile->zenzai_use_draft_model(),
+                 ConfigDefs::CheckboxDefaults::ZENZAI_USE_DRAFT_MODEL);
+    SET_CHECKBOX(ui_->zenzaiPersistScoreCache,
+                 context_.currentProfile->zenzai_persist_score_cache(),
+                 ConfigDefs::CheckboxDefaults::ZENZAI_PERSIST_SCORE_CACHE);
+
+    SET_SPINBOX(ui_->zenzaiThreads, context_.currentProfile->zenzai_threads(),
+                ConfigDefs::SpinboxDefaults::ZENZAI_THREADS);
+    SET_COMBO_FROM_CONFIG(ConfigDefs::ZenzaiCpuPolicy, ui_->zenzaiCpuPolicy,
+                          context_.currentProfile->zenzai_cpu_policy());
+    SET_LINEEDIT(ui_->zenzaiCpuAffinity,
+                 context_.currentProfile->zenzai_cpu_affinity(), "");
+    updateCpuAffinityEnabled();
 
     SET_LINEEDIT(ui_->zenzaiUserPlofile,
                  context_.currentProfile->zenzai_profile(), "");
@@ -81,10 +124,28 @@ void AiTabController::saveToConfig() {
 
     context_.currentProfile->set_zenzai_infer_limit(
         GET_SPINBOX_INT(ui_->zenzaiInferenceLimit));
+    context_.currentProfile->set_zenzai_time_budget_ms(
+        GET_SPINBOX_INT(ui_->zenzaiTimeBudget));
+    context_.currentProfile->set_zenzai_latency_target_ms(
+        GET_SPINBOX_INT(ui_->zenzaiLatencyTarget));
+    context_.currentProfile->set_zenzai_idle_unload_minutes(
+        GET_SPINBOX_INT(ui_->zenzaiIdleUnloadMinutes));
     context_.currentProfile->set_zenzai_enable(
         GET_CHECKBOX_BOOL(ui_->enableZenzai));
     context_.currentProfile->set_zenzai_contextual_mode(
         GET_CHECKBOX_BOOL(ui_->zenzaiContextualConversion));
+    context_.currentProfile->set_zenzai_isolated_worker(
+        GET_CHECKBOX_BOOL(ui_->zenzaiIsolatedWorker));
+    context_.currentProfile->set_zenzai_use_draft_model(
+        GET_CHECKBOX_BOOL(ui_->zenzaiUseDraftModel));
+    context_.currentProfile->set_zenzai_persist_score_cache(
+        GET_CHECKBOX_BOOL(ui_->zenzaiPersistScoreCache));
+    context_.currentProfile->set_zenzai_threads(
+        GET_SPINBOX_INT(ui_->zenzaiThreads));
+    context_.currentProfile->set_zenzai_cpu_policy(
+        GET_COMBO_TO_CONFIG(ConfigDefs::ZenzaiCpuPolicy, ui_->zenzaiCpuPolicy));
+    context_.currentProfile->set_zenzai_cpu_affinity(
+        GET_LINEEDIT_STRING(ui_->zenzaiCpuAffinity));
     context_.currentProfile->set_zenzai_profile(
         GET_LINEEDIT_STRING(ui_->zenzaiUserPlofile));
 
@@ -287,6 +348,71 @@ QString AiTabController::calculateFileSHA256(const QString& filePath) {
     return QString(hash.result().toHex());
 }
 
+void AiTabController::onRunBenchmark() {
+    if (!context_.server) return;
+
+    auto result = context_.server->benchmarkZenzai(true);
+    if (!result.has_value()) {
+        ui_->zenzaiBenchmarkResults->setText(
+            tr("Failed to start the benchmark."));
+        return;
+    }
+    ui_->zenzaiBenchmarkButton->setEnabled(false);
+    ui_->zenzaiBenchmarkResults->setText(
+        tr("Running benchmark. This may take a few minutes..."));
+    benchmarkTimer_->start();
+}
+
+void AiTabController::onPollBenchmark() {
+    auto result = context_.server ? context_.server->benchmarkZenzai(false)
+                                  : std::nullopt;
+    if (result.has_value() && result->running()) {
+        return;
+    }
+    benchmarkTimer_->stop();
+    ui_->zenzaiBenchmarkButton->setEnabled(true);
+
+    if (!result.has_value()) {
+        ui_->zenzaiBenchmarkResults->setText(
+            tr("Failed to get the benchmark result."));
+        return;
+    }
+    if (!result->error_message().empty()) {
+        ui_->zenzaiBenchmarkResults->setText(
+            tr("Benchmark failed: %1")
+                .arg(QString::fromStdString(result->error_message())));
+        return;
+    }
+
+    QStringList lines;
+    for (const auto& device : result->results()) {
+        QString line = tr("%1, %2 threads: %3 ms/conversion, %4 chars/s")
+                           .arg(QString::fromStdString(device.device_name()))
+                           .arg(device.threads())
+                           .arg(device.mean_latency_ms(), 0, 'f', 0)
+                           .arg(device.chars_per_second(), 0, 'f', 1);
+        if (device.draft_mean_latency_ms() > 0) {
+            line = tr("%1 (draft model: %2 ms/conversion)")
+                       .arg(line)
+                       .arg(device.draft_mean_latency_ms(), 0, 'f', 0);
+        }
+        lines << line;
+    }
+    QString fastest = QString::fromStdString(result->fastest_device_name());
+    if (!fastest.isEmpty()) {
+        lines << tr("Fastest: %1 with %2 threads (selected above, press Apply "
+                    "to use it)")
+                     .arg(fastest)
+                     .arg(result->fastest_threads());
+        int index = ui_->zenzaiBackendDevice->findData(fastest);
+        if (index >= 0) {
+            ui_->zenzaiBackendDevice->setCurrentIndex(index);
+        }
+        ui_->zenzaiThreads->setValue(result->fastest_threads());
+    }
+    ui_->zenzaiBenchmarkResults->setText(lines.join("\n"));
+}
+
 void AiTabController::refreshWarnings() {
     if (ui_->aiTabScrollContentsLayout->count() > 1) {
         QLayoutItem* item = ui_->aiTabScrollContentsLayout->itemAt(1);
@@ -304,8 +430,18 @@ void AiTabController::refreshWarnings() {
         ui_->enableZenzai->setEnabled(false);
         ui_->zenzaiContextualConversion->setEnabled(false);
         ui_->zenzaiInferenceLimit->setEnabled(false);
+        ui_->zenzaiTimeBudget->setEnabled(false);
+        ui_->zenzaiLatencyTarget->setEnabled(false);
         ui_->zenzaiUserPlofile->setEnabled(false);
         ui_->zenzaiBackendDevice->setEnabled(false);
+        ui_->zenzaiIsolatedWorker->setEnabled(false);
+        ui_->zenzaiUseDraftModel->setEnabled(false);
+        ui_->zenzaiPersistScoreCache->setEnabled(false);
+        ui_->zenzaiIdleUnloadMinutes->setEnabled(false);
+        ui_->zenzaiThreads->setEnabled(false);
+        ui_->zenzaiCpuPolicy->setEnabled(false);
+        ui_->zenzaiCpuAffinity->setEnabled(false);
+        ui_->zenzaiBenchmarkButton->setEnabled(false);
 
         QWidget* warningWidget = WarningWidgetFactory::create(
             tr("<b>Warning:</b> Zenzai support not installed."), "yellow");
@@ -314,8 +450,18 @@ void AiTabController::refreshWarnings() {
         ui_->enableZenzai->setEnabled(false);
         ui_->zenzaiContextualConversion->setEnabled(false);
         ui_->zenzaiInferenceLimit->setEnabled(false);
+        ui_->zenzaiTimeBudget->setEnabled(false);
+        ui_->zenzaiLatencyTarget->setEnabled(false);
         ui_->zenzaiUserPlofile->setEnabled(false);
         ui_->zenzaiBackendDevice->setEnabled(false);
+        ui_->zenzaiIsolatedWorker->setEnabled(false);
+        ui_->zenzaiUseDraftModel->setEnabled(false);
+        ui_->zenzaiPersistScoreCache->setEnabled(false);
+        ui_->zenzaiIdleUnloadMinutes->setEnabled(false);
+        ui_->zenzaiThreads->setEnabled(false);
+        ui_->zenzaiCpuPolicy->setEnabled(false);
+        ui_->zenzaiCpuAffinity->setEnabled(false);
+        ui_->zenzaiBenchmarkButton->setEnabled(false);
 
         QWidget* warningWidget = WarningWidgetFactory::create(
             tr("<b>Warning:</b> Zenzai model not found."), "yellow",
@@ -325,12 +471,36 @@ void AiTabController::refreshWarnings() {
         ui_->enableZenzai->setEnabled(true);
         ui_->zenzaiContextualConversion->setEnabled(true);
         ui_->zenzaiInferenceLimit->setEnabled(true);
+        ui_->zenzaiTimeBudget->setEnabled(true);
+        ui_->zenzaiLatencyTarget->setEnabled(true);
         ui_->zenzaiUserPlofile->setEnabled(true);
         ui_->zenzaiBackendDevice->setEnabled(true);
+        ui_->zenzaiIsolatedWorker->setEnabled(true);
+        ui_->zenzaiUseDraftModel->setEnabled(
+            context_.currentConfig->zenzai_draft_model_available());
+        ui_->zenzaiPersistScoreCache->setEnabled(true);
+        ui_->zenzaiIdleUnloadMinutes->setEnabled(true);
+        ui_->zenzaiThreads->setEnabled(true);
+        ui_->zenzaiCpuPolicy->setEnabled(true);
+        updateCpuAffinityEnabled();
+        ui_->zenzaiBenchmarkButton->setEnabled(!benchmarkTimer_->isActive());
+
+        std::optional<hazkey::commands::ServerStats> stats;
+        if (context_.server) {
+            stats = context_.server->getServerStats();
+        }
 
         QString modelPath =
             QString::fromStdString(context_.currentConfig->zenzai_model_path());
-        if (!modelPath.isEmpty()) {
+        if (stats.has_value() &&
+            stats->zenzai().model_state() ==
+                hazkey::commands::ServerStats::ZenzaiStats::MODEL_LOADING) {
+            QWidget* warningWidget = WarningWidgetFactory::create(
+                tr("Zenzai model is loading. Conversion uses the dictionary "
+                   "only until it is ready."),
+                "lightblue");
+            ui_->aiTabScrollContentsLayout->insertWidget(1, warningWidget);
+        } else if (!modelPath.isEmpty()) {
             QString currentChecksum = calculateFileSHA256(modelPath);
             QString expectedChecksum = kZenzaiExpectedChecksum;
 
@@ -346,6 +516,13 @@ void AiTabController::refreshWarnings() {
     }
 }
 
+void AiTabController::updateCpuAffinityEnabled() {
+    ui_->zenzaiCpuAffinity->setEnabled(
+        ui_->zenzaiCpuPolicy->isEnabled() &&
+        GET_COMBO_TO_CONFIG(ConfigDefs::ZenzaiCpuPolicy, ui_->zenzaiCpuPolicy) ==
+            hazkey::config::Profile_ZenzaiCpuPolicy_ZENZAI_CPU_CUSTOM_AFFINITY);
+}
+
 void AiTabController::populateDeviceList() {
     ui_->zenzaiBackendDevice->clear();
     for (int i = 0;
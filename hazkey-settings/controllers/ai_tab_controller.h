@@ -12,6 +12,7 @@
 class QWidget;
 class QNetworkAccessManager;
 class QProgressDialog;
+class QTimer;
 
 namespace Ui {
 class MainWindow;
@@ -35,11 +36,14 @@ class AiTabController : public QObject {
     void onDownloadProgress(qint64 bytesReceived, qint64 bytesTotal);
     void onDownloadFinished();
     void onDownloadError(QNetworkReply::NetworkError error);
+    void onRunBenchmark();
+    void onPollBenchmark();
 
    private:
     QString calculateFileSHA256(const QString& filePath);
     void refreshWarnings();
     void populateDeviceList();
+    void updateCpuAffinityEnabled();
     void updateSelectionFromProfile();
 
     Ui::MainWindow* ui_;
@@ -48,6 +52,7 @@ class AiTabController : public QObject {
     QNetworkAccessManager* networkManager_;
     QNetworkReply* currentDownload_;
     QProgressDialog* downloadProgressDialog_;
+    QTimer* benchmarkTimer_;
     QString zenzaiModelPath_;
     std::atomic<bool> isLoading_{false};
 };
@@ -65,6 +65,9 @@ void ConversionTabController::loadFromConfig() {
     SET_CHECKBOX(ui_->hazkeyVersionConversion,
                  specialConversions->hazkey_version(),
                  ConfigDefs::CheckboxDefaults::HAZKEY_VERSION);
+    SET_CHECKBOX(ui_->typoCorrectionConversion,
+                 specialConversions->typo_correction(),
+                 ConfigDefs::CheckboxDefaults::TYPO_CORRECTION);
 
     ui_->stopStoreNewHistory->setEnabled(
         context_.currentProfile->use_input_history());
@@ -97,6 +100,8 @@ void ConversionTabController::saveToConfig() {
         GET_CHECKBOX_BOOL(ui_->romanTypographyConversion));
     specialConversions->set_hazkey_version(
         GET_CHECKBOX_BOOL(ui_->hazkeyVersionConversion));
+    specialConversions->set_typo_correction(
+        GET_CHECKBOX_BOOL(ui_->typoCorrectionConversion));
 }
 
 void ConversionTabController::onUseHistoryToggled(bool enabled) {
@@ -113,6 +118,7 @@ void ConversionTabController::onCheckAllConversion() {
     ui_->unicodeCodePointConversion->setChecked(true);
     ui_->romanTypographyConversion->setChecked(true);
     ui_->hazkeyVersionConversion->setChecked(true);
+    ui_->typoCorrectionConversion->setChecked(true);
 }
 
 void ConversionTabController::onUncheckAllConversion() {
@@ -125,6 +131,7 @@ void ConversionTabController::onUncheckAllConversion() {
     ui_->unicodeCodePointConversion->setChecked(false);
     ui_->romanTypographyConversion->setChecked(false);
     ui_->hazkeyVersionConversion->setChecked(false);
+    ui_->typoCorrectionConversion->setChecked(false);
 }
 
 void ConversionTabController::onClearLearningData() {
@@ -26,6 +26,16 @@ void UserInterfaceTabController::loadFromConfig() {
 
     SET_SPINBOX(ui_->numSuggestion, context_.currentProfile->num_suggestions(),
                 ConfigDefs::SpinboxDefaults::NUM_SUGGESTIONS);
+    SET_CHECKBOX(ui_->englishPrediction,
+                 context_.currentProfile->use_english_prediction(),
+                 ConfigDefs::CheckboxDefaults::USE_ENGLISH_PREDICTION);
+    // the option does nothing without a word list
+    const bool englishLexiconAvailable =
+        context_.currentConfig &&
+        context_.currentConfig->english_lexicon_available();
+    ui_->englishPrediction->setEnabled(englishLexiconAvailable);
+    ui_->englishPrediction->setToolTip(
+        englishLexiconAvailable ? QString() : tr("English word list not installed"));
     SET_SPINBOX(ui_->numCandidatesPerPage,
                 context_.currentProfile->num_candidates_per_page(),
                 ConfigDefs::SpinboxDefaults::NUM_CANDIDATES_PER_PAGE);
@@ -43,6 +53,8 @@ void UserInterfaceTabController::saveToConfig() {
 
     context_.currentProfile->set_num_suggestions(
         GET_SPINBOX_INT(ui_->numSuggestion));
+    context_.currentProfile->set_use_english_prediction(
+        GET_CHECKBOX_BOOL(ui_->englishPrediction));
     context_.currentProfile->set_num_candidates_per_page(
         GET_SPINBOX_INT(ui_->numCandidatesPerPage));
 }
@@ -329,3 +329,39 @@ bool ServerConnector::reloadZenzaiModel() {
     auto responseVal = response.value();
     return responseVal.status() == hazkey::SUCCESS;
 }
+
+std::optional<hazkey::commands::ServerStats> ServerConnector::getServerStats() {
+    hazkey::RequestEnvelope request;
+    auto _ = request.mutable_get_server_stats();
+    auto response = transact(request);
+    if (response == std::nullopt) {
+        return std::nullopt;
+    }
+    auto responseVal = response.value();
+    if (responseVal.status() != hazkey::SUCCESS) {
+        return std::nullopt;
+    }
+    if (!responseVal.has_server_stats()) {
+        return std::nullopt;
+    }
+    return responseVal.server_stats();
+}
+
+std::optional<hazkey::config::ZenzaiBenchmarkResult>
+ServerConnector::benchmarkZenzai(bool start) {
+    hazkey::RequestEnvelope request;
+    auto benchmarkRequest = request.mutable_benchmark_zenzai();
+    benchmarkRequest->set_start(start);
+    auto response = transact(request);
+    if (response == std::nullopt) {
+        return std::nullopt;
+    }
+    auto responseVal = response.value();
+    if (responseVal.status() != hazkey::SUCCESS) {
+        return std::nullopt;
+    }
+    if (!responseVal.has_zenzai_benchmark_result()) {
+        return std::nullopt;
+    }
+    return responseVal.zenzai_benchmark_result();
+}
@@ -14,6 +14,9 @@ class ServerConnector {
     void setCurrentConfig(hazkey::config::CurrentConfig);
     bool clearAllHistory(const std::string& profileId);
     bool reloadZenzaiModel();
+    std::optional<hazkey::commands::ServerStats> getServerStats();
+    std::optional<hazkey::config::ZenzaiBenchmarkResult> benchmarkZenzai(
+        bool start);
 
     // Begin a session with persistent connection
     bool beginSession();